@@ -0,0 +1,341 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <Json.hpp>
+#include <JsonBind.hpp>
+#include <JsonCbor.hpp>
+#include <JsonDocument.hpp>
+#include <JsonKeyPool.hpp>
+#include <JsonParseCache.hpp>
+#include <JsonParser.hpp>
+
+// Замеры производительности. Входные данные генерируются детерминированно, поэтому числа
+// разных запусков сравнимы между собой. Запуск: JsonBench [сценарий ...], без аргументов
+// выполняются все сценарии. Каждый замер повторяется, выводится лучшее время.
+// Сценарий broker-input не замеряет, а пишет вход для JsonBroker в текущий каталог
+
+// Поля записи из makeRecords, нужные JsonBind; description пропускается
+struct Record
+{
+    int64_t id = 0;
+    std::string ticker;
+    double price = 0;
+    bool active = false;
+    std::vector<std::string> tags;
+};
+
+template <>
+struct JsonBinding<Record>
+{
+    static constexpr auto fields = std::make_tuple(JSON_FIELD(Record, id), JSON_FIELD(Record, ticker),
+                                                   JSON_FIELD(Record, price), JSON_FIELD(Record, active),
+                                                   JSON_FIELD(Record, tags));
+};
+
+namespace
+{
+    const size_t REPEATS = 3;
+
+    // Лучшее время выполнения action в секундах
+    double measure(const std::function<void()> &action)
+    {
+        double best = 0;
+        for (size_t i = 0; i < REPEATS; i++) {
+            auto start = std::chrono::steady_clock::now();
+            action();
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            best = i == 0 ? elapsed.count() : std::min(best, elapsed.count());
+        }
+        return best;
+    }
+
+    // Пропускная способность выводится, если известен объем данных bytes
+    void report(const std::string &name, double seconds, size_t bytes = 0)
+    {
+        std::printf("  %-28s %9.1f ms", name.c_str(), seconds * 1e3);
+        if (bytes != 0) {
+            std::printf(" %9.1f MB/s", bytes / 1e6 / seconds);
+        }
+        std::printf("\n");
+    }
+
+    // Массив из count записей вида
+    // {"id": 17, "ticker": "TCK17", "price": 108.5, "active": false, "tags": ["a", "b"], "description": "..."}
+    std::string makeRecords(size_t count)
+    {
+        std::string text = "[";
+        for (size_t i = 0; i < count; i++) {
+            std::string id = std::to_string(i);
+            text += i ? ",\n" : "\n";
+            text += R"({"id": )" + id + R"(, "ticker": "TCK)" + id + R"(", "price": )" + std::to_string(100 + i % 97)
+                + "." + std::to_string(i % 10) + R"(, "active": )" + (i % 3 ? "true" : "false")
+                + R"(, "tags": ["alpha", "beta", "gamma"], "description": "Record number )" + id
+                + R"( with \"escaped\" text and unicode é"})";
+        }
+        text += "\n]";
+        return text;
+    }
+
+    // Обработчик, который только считает события: стоимость разбора без построения дерева
+    class Counter : public JsonHandler
+    {
+    public:
+        void startObject() override
+        {
+            events++;
+        }
+
+        void key(std::string_view) override
+        {
+            events++;
+        }
+
+        void endObject() override
+        {
+            events++;
+        }
+
+        void startArray() override
+        {
+            events++;
+        }
+
+        void endArray() override
+        {
+            events++;
+        }
+
+        void string(std::string_view) override
+        {
+            events++;
+        }
+
+        void number(double) override
+        {
+            events++;
+        }
+
+        void boolean(bool) override
+        {
+            events++;
+        }
+
+        void null() override
+        {
+            events++;
+        }
+
+        size_t events = 0;
+    };
+
+    // Временный файл с текстом, удаляется вместе с образом кэша
+    class TemporaryFile
+    {
+    public:
+        explicit TemporaryFile(const std::string &text)
+            : path((std::filesystem::temp_directory_path() / "JsonBench.json").string())
+        {
+            std::ofstream(path) << text;
+        }
+
+        ~TemporaryFile()
+        {
+            std::filesystem::remove(path);
+            std::filesystem::remove(path + JsonParseCache::EXTENSION);
+        }
+
+        TemporaryFile(const TemporaryFile &) = delete;
+
+        TemporaryFile &operator=(const TemporaryFile &) = delete;
+
+        const std::string path;
+    };
+
+    // Лучшее время разбора и отдельно разрушения результата parse()
+    template <typename Parse>
+    void parseAndDestroy(const std::string &name, size_t bytes, Parse parse)
+    {
+        double parsing = 0;
+        double destroying = 0;
+        for (size_t i = 0; i < REPEATS; i++) {
+            auto start = std::chrono::steady_clock::now();
+            std::optional result{parse()};
+            auto parsed = std::chrono::steady_clock::now();
+            result.reset();
+            std::chrono::duration<double> parseTime = parsed - start;
+            std::chrono::duration<double> destroyTime = std::chrono::steady_clock::now() - parsed;
+            parsing = i == 0 ? parseTime.count() : std::min(parsing, parseTime.count());
+            destroying = i == 0 ? destroyTime.count() : std::min(destroying, destroyTime.count());
+        }
+        report(name + " parse", parsing, bytes);
+        report(name + " teardown", destroying);
+    }
+
+    // Разбор в Json против записи того же дерева обратно в текст
+    void serialize()
+    {
+        std::string text = makeRecords(200000);
+        std::cout << "serialize: " << text.size() / 1000000 << " MB of records\n";
+        parseAndDestroy("Json", text.size(), [&] { return Json::parse(text); });
+
+        Json json = Json::parse(text);
+        std::string dumped;
+        double dumping = measure([&] { dumped = json.dump(); });
+        report("Json::dump", dumping, dumped.size());
+    }
+
+    // Дерево Json против документа в арене
+    void document()
+    {
+        std::string text = makeRecords(200000);
+        std::cout << "document: " << text.size() / 1000000 << " MB of records\n";
+        parseAndDestroy("Json", text.size(), [&] { return Json::parse(text); });
+        parseAndDestroy("JsonDocument", text.size(), [&] { return JsonDocument::parse(text); });
+    }
+
+    // Память документа с ключами в арене и в общем пуле
+    void keyPool()
+    {
+        std::string text = makeRecords(300000);
+        JsonDocument plain = JsonDocument::parse(text);
+        auto pool = std::make_shared<JsonKeyPool>();
+        JsonDocument interned = JsonDocument::parse(text, pool);
+
+        std::cout << "key-pool: " << text.size() / 1000000 << " MB of records\n";
+        std::printf("  %-28s %9.1f MB\n", "arena, own keys", plain.getMemoryUsage() / 1e6);
+        std::printf("  %-28s %9.1f MB\n", "arena, interned keys", interned.getMemoryUsage() / 1e6);
+        std::printf("  %-28s %9.3f MB, %zu keys\n", "key pool", pool->getMemoryUsage() / 1e6, pool->getSize());
+    }
+
+    // Разбор CBOR против разбора текста: события и дерево Json
+    void cbor()
+    {
+        std::string text = makeRecords(200000);
+        std::string encoded = JsonCbor::encode(Json::parse(text));
+        std::cout << "cbor: " << text.size() / 1000000 << " MB of text, " << encoded.size() / 1000000
+                  << " MB of CBOR\n";
+
+        Counter counter;
+        report("text events", measure([&] { JsonParser::parse(text, counter); }), text.size());
+        report("CBOR events", measure([&] { JsonCbor::decode(encoded, counter); }), encoded.size());
+        report("text to Json", measure([&] { Json::parse(text); }), text.size());
+        report("CBOR to Json", measure([&] { JsonCbor::decode(encoded); }), encoded.size());
+    }
+
+    // Загрузка файла из образа кэша против разбора текста
+    void cache()
+    {
+        std::string text = makeRecords(200000);
+        TemporaryFile file(text);
+        JsonParseCache parseCache;
+        parseCache.parseDocument(file.path);
+
+        std::cout << "cache: " << text.size() / 1000000 << " MB of records\n";
+        report("text to JsonDocument", measure([&] { JsonDocument::parseFile(file.path); }), text.size());
+        report("cache to JsonDocument", measure([&] { parseCache.parseDocument(file.path); }), text.size());
+        report("text to Json", measure([&] { Json::parseFile(file.path); }), text.size());
+        report("cache to Json", measure([&] { parseCache.parseFile(file.path); }), text.size());
+        std::cout << "  hits: " << parseCache.getHits() << ", misses: " << parseCache.getMisses() << "\n";
+    }
+
+    // Разбор прямо в структуры против дерева Json и копирования из него
+    void bind()
+    {
+        std::string text = makeRecords(200000);
+        std::cout << "bind: " << text.size() / 1000000 << " MB of records\n";
+
+        report("JsonBind", measure([&] { JsonBind::parse<std::vector<Record>>(text); }), text.size());
+        report("Json and copy-out", measure([&] {
+            Json json = Json::parse(text);
+            std::vector<Record> records(json.getSize());
+            for (size_t i = 0; i < records.size(); i++) {
+                Json &object = *std::any_cast<Json *>(json[static_cast<int>(i)]);
+                Record &record = records[i];
+                record.id = static_cast<int64_t>(std::any_cast<double>(object["id"]));
+                record.ticker = std::any_cast<std::string>(object["ticker"]);
+                record.price = std::any_cast<double>(object["price"]);
+                record.active = std::any_cast<bool>(object["active"]);
+                Json &tags = *std::any_cast<Json *>(object["tags"]);
+                for (size_t j = 0; j < tags.getSize(); j++) {
+                    record.tags.push_back(std::any_cast<std::string>(tags[static_cast<int>(j)]));
+                }
+            }
+        }), text.size());
+    }
+
+    // Вход JsonBroker: три столбца по 3 миллиона элементов
+    void brokerInput()
+    {
+        const size_t rows = 3000000;
+        const char *path = "broker-input.json";
+        std::ofstream output(path);
+        for (size_t column = 0; column < 3; column++) {
+            output << (column ? ",\n[" : "[\n[");
+            for (size_t i = 0; i < rows; i++) {
+                output << (i ? ", " : "");
+                if (column == 0) {
+                    output << "\"TCK" << i << "\"";
+                } else if (column == 1) {
+                    output << i;
+                } else {
+                    output << "\"Description of instrument " << i << "\"";
+                }
+            }
+            output << "]";
+        }
+        output << "\n]\n";
+        std::cout << "broker-input: " << rows << " rows written to " << path
+                  << ", run: JsonBroker " << path << " broker-output.json\n";
+    }
+
+    struct Scenario
+    {
+        const char *name;
+        void (*run)();
+    };
+
+    const Scenario SCENARIOS[] = {
+        {"serialize", serialize},
+        {"document", document},
+        {"key-pool", keyPool},
+        {"cbor", cbor},
+        {"cache", cache},
+        {"bind", bind},
+        {"broker-input", brokerInput},
+    };
+}
+
+int main(int argc, char *argv[])
+{
+    std::vector<std::string> selected(argv + 1, argv + argc);
+    for (const std::string &name : selected) {
+        auto found = std::find_if(std::begin(SCENARIOS), std::end(SCENARIOS),
+                                  [&](const Scenario &scenario) { return name == scenario.name; });
+        if (found == std::end(SCENARIOS)) {
+            std::cout << "Unknown scenario '" << name << "'. Available:";
+            for (const Scenario &scenario : SCENARIOS) {
+                std::cout << " " << scenario.name;
+            }
+            std::cout << "\n";
+            return 1;
+        }
+    }
+
+    for (const Scenario &scenario : SCENARIOS) {
+        // Генератор входа брокера пишет файл, поэтому выполняется только по имени
+        bool isGenerator = scenario.run == brokerInput;
+        bool isSelected = std::find(selected.begin(), selected.end(), scenario.name) != selected.end();
+        if (selected.empty() ? !isGenerator : isSelected) {
+            scenario.run();
+        }
+    }
+}
@@ -1,10 +1,153 @@
-#include <iostream>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
 #include <fstream>
-#include <nlohmann/json.hpp>
-#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+
+#include <JsonFile.hpp>
+#include <JsonReader.hpp>
+#include <JsonWriter.hpp>
+
+// Ошибка формата входа, сообщение выводится пользователю как есть
+class BrokerError : public std::runtime_error
+{
+public:
+    using std::runtime_error::runtime_error;
+};
+
+// Переписывает события разбора в JsonWriter: значение копируется без построения дерева
+class WriterHandler
+{
+public:
+    explicit WriterHandler(JsonWriter &outputWriter)
+        : writer(outputWriter)
+    {}
+
+    void startObject()
+    {
+        writer.beginObject();
+    }
+
+    void key(std::string_view key)
+    {
+        writer.key(key);
+    }
+
+    void endObject()
+    {
+        writer.endObject();
+    }
+
+    void startArray()
+    {
+        writer.beginArray();
+    }
+
+    void endArray()
+    {
+        writer.endArray();
+    }
+
+    void string(std::string_view value)
+    {
+        writer.value(value);
+    }
+
+    void number(double value)
+    {
+        writer.value(value);
+    }
+
+    void integer(int64_t value)
+    {
+        writer.value(value);
+    }
+
+    void unsignedInteger(uint64_t value)
+    {
+        writer.value(value);
+    }
+
+    void boolean(bool value)
+    {
+        writer.value(value);
+    }
+
+    void null()
+    {
+        writer.value(nullptr);
+    }
+
+private:
+    JsonWriter &writer;
+};
+
+// Один из трех столбцов входа [[tickers], [ids], [descriptions]]. У каждого столбца свой
+// JsonReader над общим отображением файла: предыдущие столбцы пропускаются по структурному
+// индексу, а элементы читаются по одному, поэтому столбцы обходятся параллельно
+class Column
+{
+public:
+    Column(const JsonFile &input, size_t number, JsonWriter &writer)
+        : handler(writer), reader(input.begin(), input.end(), handler)
+    {
+        try {
+            reader.enterArray();
+        } catch (const JsonParseUnexpectedChar &) {
+            throw BrokerError{"Input JSON is not an array"};
+        }
 
-auto hello()
+        for (size_t i = 0; i < number; i++) {
+            if (!reader.nextElement()) {
+                throw BrokerError{"Input JSON array size is not 3"};
+            }
+            reader.skipValue();
+        }
+        if (!reader.nextElement()) {
+            throw BrokerError{"Input JSON array size is not 3"};
+        }
+
+        try {
+            reader.enterArray();
+        } catch (const JsonParseUnexpectedChar &) {
+            throw BrokerError{"Input JSON nested value is not an array"};
+        }
+    }
+
+    // Есть ли в столбце следующий элемент
+    bool next()
+    {
+        return reader.nextElement();
+    }
+
+    // Переписать текущий элемент в выход
+    void write()
+    {
+        reader.parseValue();
+    }
+
+    // Для последнего столбца: за ним вход должен закончиться
+    void finish()
+    {
+        if (reader.nextElement()) {
+            throw BrokerError{"Input JSON array size is not 3"};
+        }
+        reader.parseEnd();
+    }
+
+private:
+    WriterHandler handler;
+    JsonReader<WriterHandler> reader;
+};
+
+auto hello(int argc, char *argv[])
 {
+    if (argc == 3) {
+        return std::make_pair(std::string(argv[1]), std::string(argv[2]));
+    }
+
     std::cout << "The broker app. Read JSON file and processes it\n";
     std::cout << "Enter input filename: ";
 
@@ -19,54 +162,86 @@ auto hello()
     return std::make_pair(input, output);
 }
 
-int main()
+// Переставляет столбцы в строки по мере чтения и возвращает число строк
+size_t process(const JsonFile &input, std::ofstream &output)
 {
-    auto fileInfo = hello();
+    JsonWriter writer(output, 4);
 
-    // Prepare input file
-    std::ifstream input(fileInfo.first);
-    if (input.fail()) {
-        std::cout << "File error\n";
-        return 1;
-    }
+    Column tickers(input, 0, writer);
+    Column ids(input, 1, writer);
+    Column descriptions(input, 2, writer);
 
-    // Serialize
-    nlohmann::json json;
-    input >> json;
+    size_t rows = 0;
+    writer.beginArray();
+    while (true) {
+        bool hasTicker = tickers.next();
+        if (hasTicker != ids.next() || hasTicker != descriptions.next()) {
+            throw BrokerError{"Input JSON nested array sizes are not equal"};
+        }
+        if (!hasTicker) {
+            break;
+        }
 
-    // Проверка
-    if (!json.is_array()) {
-        std::cout << "Input JSON is not an array\n";
-        return 1;
+        // Ключи в алфавитном порядке, как в прежнем выводе
+        writer.beginObject();
+        writer.key("description");
+        descriptions.write();
+        writer.key("id");
+        ids.write();
+        writer.key("ticker");
+        tickers.write();
+        writer.endObject();
+        rows++;
     }
-    if (json.size() != 3) {
-        std::cout << "Input JSON array size is not 3\n";
+    writer.endArray();
+    descriptions.finish();
+
+    writer.flush();
+    output << std::endl;
+    return rows;
+}
+
+int main(int argc, char *argv[])
+{
+    auto fileInfo = hello(argc, argv);
+
+    // Prepare input file
+    std::optional<JsonFile> input;
+    try {
+        input.emplace(fileInfo.first);
+    } catch (const JsonParseFileException &) {
+        std::cout << "File error\n";
         return 1;
     }
-    if (!(json[0].size() == json[1].size() && json[1].size() == json[2].size())) {
-        std::cout << "Input JSON nested array sizes are not equal\n";
+
+    // Вывод идет во временный файл рядом с выходным и переименовывается только после успеха,
+    // поэтому при ошибке существующий файл (в том числе сам вход) не портится
+    std::string temporary = fileInfo.second + ".tmp";
+    std::ofstream output(temporary);
+    if (output.fail()) {
+        std::cout << "File error\n";
         return 1;
     }
 
-    // Processing
-    nlohmann::json outputJson;
-    for (size_t i = 0; i < json[0].size(); i++) {
-        outputJson.push_back(
-            nlohmann::json{
-                {"ticker", json[0][i]},
-                {"id", json[1][i]},
-                {"description", json[2][i]},
-            }
-        );
+    auto start = std::chrono::steady_clock::now();
+    size_t rows = 0;
+    try {
+        rows = process(*input, output);
+    } catch (const std::exception &exception) {
+        output.close();
+        std::remove(temporary.c_str());
+        std::cout << exception.what() << "\n";
+        return 1;
     }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
 
-    // Подготовка выходного файла
-    std::ofstream output(fileInfo.second);
-    if (output.fail()) {
+    output.close();
+    if (output.fail() || std::rename(temporary.c_str(), fileInfo.second.c_str()) != 0) {
+        std::remove(temporary.c_str());
         std::cout << "File error\n";
         return 1;
     }
 
-    // Вывод
-    output << std::setw(4) << outputJson << std::endl;
-}
\ No newline at end of file
+    std::cout << "Rows: " << rows << ", " << static_cast<uint64_t>(rows / std::max(elapsed.count(), 1e-9))
+              << " rows/sec\n";
+}
@@ -2,7 +2,10 @@
 
 #include <string>
 #include <any>
+#include <iosfwd>
+#include <memory>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "JsonException.hpp"
@@ -13,46 +16,79 @@ public:
     using ObjectType = std::unordered_map<std::string, std::any>;       // Тип сериализованного json-объекта
     using ArrayType = std::vector<std::any>;                            // Тип сериализованного json-массива
 
-    // Конструктор из строки, содержащей Json-данные.
-    explicit Json(const std::string &string);
+    // Конструктор из строки, содержащей Json-данные. Если preciseIntegers, целые числа
+    // хранятся как int64_t (или uint64_t, если больше INT64_MAX), иначе все числа - double
+    explicit Json(const std::string &string, bool preciseIntegers = false);
 
     // Конструктор из сериализованного объекта
-    explicit Json(const ObjectType &object)
-        : objectData(new ObjectType(object))
-    {}
+    explicit Json(const ObjectType &object);
+
+    // Конструктор, забирающий сериализованный объект без копирования
+    explicit Json(ObjectType &&object);
 
     // Конструктор из сериализованного массива
-    explicit Json(const ArrayType &object)
-        : arrayData(new ArrayType(object))
-    {}
+    explicit Json(const ArrayType &object);
+
+    // Конструктор, забирающий сериализованный массив без копирования
+    explicit Json(ArrayType &&array);
 
     // Пустой конструктор
     Json() = default;
 
-    // Конструктор копирования
-    Json(const Json &json)
-    {
-        *this = json;
-    }
+    // Конструктор копирования. Копия разделяет данные с исходным экземпляром,
+    // поддерево клонируется только при изменении, подробнее см. detach и expose
+    Json(const Json &json);
 
     // Конструктор перемещения
-    Json(Json &&json) noexcept
-    {
-        *this = std::forward<Json>(json);
-    }
+    Json(Json &&json) noexcept = default;
 
-    // Копирующее присваивание
+    // Копирующее присваивание, как и копирование
     Json &operator=(const Json &json);
 
     // Перемещающее присваивание
-    Json &operator=(Json &&json) noexcept;
+    Json &operator=(Json &&json) noexcept = default;
 
     // Добавить в словарь ключ, значение
     void addToObjectKey(const std::string &key, const std::any &value);
 
+    // Добавить в словарь ключ, значение без их копирования
+    void addToObjectKey(std::string &&key, std::any &&value);
+
+    // Добавить в словарь по ключу key значение типа T, построенное из args.
+    // Возвращает ссылку на сохраненное значение
+    template<typename T, typename... Args>
+    T &emplaceToObjectKey(std::string key, Args &&...args)
+    {
+        if (!objectData) {
+            throw JsonUnexpectedType("Expected JSON object");
+        }
+
+        // Значение строится до вставки, чтобы исключение конструктора не оставило пустой ключ
+        std::any value{std::in_place_type<T>, std::forward<Args>(args)...};
+        expose();
+        std::any &slot = (*objectData)[std::move(key)];
+        slot = std::move(value);
+        return *std::any_cast<T>(&slot);
+    }
+
     // Добавить значение в массив
     void addToArray(const std::any &value);
 
+    // Добавить значение в массив без копирования
+    void addToArray(std::any &&value);
+
+    // Добавить в массив значение типа T, построенное из args. Возвращает ссылку на сохраненное значение
+    template<typename T, typename... Args>
+    T &emplaceToArray(Args &&...args)
+    {
+        addToArray(std::any{std::in_place_type<T>, std::forward<Args>(args)...});
+        expose();
+        return *std::any_cast<T>(&arrayData->back());
+    }
+
+    // Зарезервировать место под size элементов массива или ключей объекта
+    void reserve(size_t size);
+
     // Получить список ключей, если JSON-объект
     [[nodiscard]] std::vector<std::string> getKeys() const;
 
@@ -76,23 +112,76 @@ public:
     // Если экземпляр является JSON-массивом, генерируется исключение.
     std::any &operator[](const std::string &key);
 
+    // Доступ на чтение: ничего не клонирует и не меняет, поэтому копии продолжают разделять данные,
+    // а одновременное чтение из разных потоков безопасно. Полученный вложенный Json * может
+    // разделяться с копиями и доступен только для чтения; для изменения нужен неконстантный operator[]
+    const std::any &operator[](const std::string &key) const;
+
     // Метод возвращает значение по индексу index, если экземпляр является JSON-массивом.
     // Значение может иметь один из следующих типов: Json, std::string, double, bool или быть пустым.
     // Если экземпляр является JSON-объектом, генерируется исключение.
     std::any &operator[](int index);
 
+    // Доступ на чтение, как у operator[](const std::string &) const
+    const std::any &operator[](int index) const;
+
     // Метод возвращает объект класса Json из строки, содержащей Json-данные.
-    static Json parse(const std::string &string)
+    static Json parse(const std::string &string, bool preciseIntegers = false)
     {
-        return Json(string);
+        return Json(string, preciseIntegers);
     }
 
     // Метод возвращает объекта класса Json из файла, содержащего Json-данные в текстовом формате.
-    static Json parseFile(const std::string &pathToFile);
+    static Json parseFile(const std::string &pathToFile, bool preciseIntegers = false);
+
+    // Метод возвращает JSON-текст. Если indent >= 0, каждый элемент выводится с новой строки
+    // с отступом indent пробелов на уровень вложенности, иначе вывод компактный
+    [[nodiscard]] std::string dump(int indent = -1) const;
+
+    // Метод записывает JSON-текст в поток, формат как у dump
+    void write(std::ostream &stream, int indent = -1) const;
+
+    // Метод возвращает документы NDJSON (по одному в строке) в порядке следования.
+    // Строки разбираются параллельно, подробнее см. JsonLines
+    static std::vector<Json> parseLines(const std::string &string, unsigned threads = 0);
+
+    // Метод возвращает объект класса Json из строки. Элементы большого корневого массива
+    // разбираются параллельно на threads потоках (0 - по числу ядер), результат и ошибки
+    // такие же, как у parse
+    static Json parseParallel(const std::string &string, unsigned threads = 0, bool preciseIntegers = false);
 
-    virtual ~Json();
+    virtual ~Json() = default;
 
 private:
-    ObjectType *objectData = nullptr;
-    ArrayType *arrayData = nullptr;
+    friend class JsonCbor;
+    friend class JsonDomBuilder;
+    friend class JsonParser;
+    friend class JsonPointer;
+    friend class JsonSerializer;
+    friend class JsonValue;
+
+    // Контейнеры разделяются между копиями; вложенные Json * принадлежат контейнеру
+    // и удаляются вместе с последней ссылкой на него
+    std::shared_ptr<ObjectType> objectData;
+    std::shared_ptr<ArrayType> arrayData;
+
+    // Наружу отданы ссылки на элементы или вложенные Json *, см. expose
+    bool exposed = false;
+
+    static std::shared_ptr<ObjectType> makeObject(ObjectType &&object);
+
+    static std::shared_ptr<ArrayType> makeArray(ArrayType &&array);
+
+    // Перед изменением разделяемый контейнер заменяется собственной копией. Вложенные Json
+    // копируются за O(1) и сами разделяют данные до своего изменения
+    void detach();
+
+    // Перед тем как отдать изменяемую ссылку на элемент, контейнер делается собственным и помечается:
+    // вложенный Json * или ссылка могут пережить копирование, поэтому копия помеченного
+    // экземпляра сразу клонирует контейнер, а не разделяет его. Иначе изменение через
+    // такой указатель было бы видно во всех копиях. Константный доступ expose не вызывает
+    void expose();
+
+    // Добавленный извне Json * остается у вызывающего, как и отданный expose
+    void exposeAdded(const std::any &value);
 };
\ No newline at end of file
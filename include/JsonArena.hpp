@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+#include <string_view>
+#include <utility>
+
+// Монотонный (bump) аллокатор. Память выделяется блоками и освобождается только целиком:
+// при release() или в деструкторе. Деструкторы размещенных объектов не вызываются.
+// Является std::pmr::memory_resource, поэтому может использоваться и pmr-контейнерами
+class JsonArena : public std::pmr::memory_resource
+{
+public:
+    explicit JsonArena(size_t firstChunkSize = 64 * 1024)
+        : nextChunkSize(firstChunkSize)
+    {}
+
+    JsonArena(const JsonArena &) = delete;
+
+    JsonArena &operator=(const JsonArena &) = delete;
+
+    ~JsonArena() override
+    {
+        release();
+    }
+
+    // Выделить size байт с выравниванием alignment (степень двойки)
+    void *allocate(size_t size, size_t alignment = alignof(std::max_align_t))
+    {
+        auto address = reinterpret_cast<uintptr_t>(current);
+        auto aligned = (address + alignment - 1) & ~(alignment - 1);
+        if (current && aligned + size <= reinterpret_cast<uintptr_t>(limit)) {
+            current = reinterpret_cast<char *>(aligned + size);
+            return reinterpret_cast<void *>(aligned);
+        }
+        return allocateSlow(size, alignment);
+    }
+
+    // Разместить массив из count объектов T без инициализации
+    template <typename T>
+    T *allocateArray(size_t count)
+    {
+        return static_cast<T *>(allocate(sizeof(T) * count, alignof(T)));
+    }
+
+    template <typename T, typename... Args>
+    T *create(Args &&... args)
+    {
+        return new(allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    }
+
+    // Скопировать строку в арену
+    std::string_view copy(std::string_view string);
+
+    // Освободить всю память арены
+    void release();
+
+    // Сколько байт запрошено у системы
+    [[nodiscard]] size_t getReservedSize() const
+    {
+        return reservedSize;
+    }
+
+private:
+    struct Chunk
+    {
+        Chunk *previous;
+    };
+
+    void *allocateSlow(size_t size, size_t alignment);
+
+    void *do_allocate(size_t bytes, size_t alignment) override
+    {
+        return allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void *, size_t, size_t) override
+    {}
+
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+    {
+        return this == &other;
+    }
+
+    char *current = nullptr;
+    char *limit = nullptr;
+    Chunk *chunks = nullptr;
+    size_t nextChunkSize;
+    size_t reservedSize = 0;
+};
\ No newline at end of file
@@ -0,0 +1,311 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "JsonException.hpp"
+#include "JsonPerfectHash.hpp"
+
+// Разбор JSON-текста прямо в структуры C++ без построения дерева Json.
+// Поля структуры перечисляются специализацией JsonBinding:
+//
+//     template <>
+//     struct JsonBinding<Person>
+//     {
+//         static constexpr auto fields = std::make_tuple(JSON_FIELD(Person, name), JSON_FIELD(Person, age));
+//     };
+//
+// Поддерживаются bool, целые и вещественные числа, std::string, структуры с JsonBinding,
+// std::vector и std::optional из них. Поле обязательно, если его тип не std::optional;
+// null допустим только для std::optional. Значения неизвестных ключей пропускаются без событий, но с проверкой грамматики.
+// Отсутствующее поле или значение не того типа - JsonBindException с путем к значению,
+// ошибки синтаксиса - те же исключения, что у JsonParser
+template <typename T>
+struct JsonBinding;
+
+// Описание поля: ключ в JSON и указатель на член структуры
+template <typename Class, typename Member>
+struct JsonField
+{
+    using MemberType = Member;
+
+    std::string_view name;
+    Member Class::*member;
+};
+
+template <typename Class, typename Member>
+JsonField(const char *, Member Class::*) -> JsonField<Class, Member>;
+
+// Поле, ключ которого совпадает с именем члена
+#define JSON_FIELD(Class, member) JsonField{#member, &Class::member}
+
+// Значение скаляра из события парсера
+struct JsonBindScalar
+{
+    enum class Kind : uint8_t
+    {
+        Bool,
+        Integer,
+        UnsignedInteger,
+        Double,
+        String,
+    };
+
+    Kind kind = Kind::Bool;
+    bool boolean = false;
+    int64_t integer = 0;
+    uint64_t unsignedInteger = 0;
+    double real = 0;
+    std::string_view string;
+};
+
+struct JsonBindField;
+
+// Стертый тип привязки: как записать значение в объект типа и как обойти его содержимое
+struct JsonBindType
+{
+    enum class Kind : uint8_t
+    {
+        Scalar,
+        Struct,
+        Vector,
+        Optional,
+    };
+
+    Kind kind;
+    const char *name;                                   // Ожидаемое значение для сообщений об ошибках
+
+    // Скаляр: false, если значение не подходит по типу или диапазону
+    bool (*assign)(void *object, const JsonBindScalar &value) = nullptr;
+
+    // Структура
+    const JsonBindField *fields = nullptr;
+    size_t fieldCount = 0;
+    size_t (*findField)(std::string_view key) = nullptr;  // Номер поля по ключу или JsonPerfectHash::NOT_FOUND
+
+    // Вектор: clear очищает, add добавляет элемент. Optional: clear сбрасывает, add создает значение.
+    // Возвращается адрес нового значения типа element()
+    const JsonBindType &(*element)() = nullptr;
+    void (*clear)(void *object) = nullptr;
+    void *(*add)(void *object) = nullptr;
+};
+
+struct JsonBindField
+{
+    std::string_view name;
+    const JsonBindType &(*type)();                      // Функция, а не указатель: типы могут быть рекурсивными
+    void *(*access)(void *object);
+    bool required;
+};
+
+// Стертые типы для поддерживаемых C++ типов
+namespace JsonBindTypes
+{
+    template <typename T>
+    struct IsVector : std::false_type
+    {};
+
+    template <typename T>
+    struct IsVector<std::vector<T>> : std::true_type
+    {};
+
+    template <typename T>
+    struct IsOptional : std::false_type
+    {};
+
+    template <typename T>
+    struct IsOptional<std::optional<T>> : std::true_type
+    {};
+
+    // Приведение числа к целому типу T без потери значения
+    template <typename T>
+    bool assignInteger(T &target, const JsonBindScalar &value)
+    {
+        switch (value.kind) {
+            case JsonBindScalar::Kind::Integer:
+                if constexpr (std::is_signed_v<T>) {
+                    if (value.integer < std::numeric_limits<T>::min() || value.integer > std::numeric_limits<T>::max()) {
+                        return false;
+                    }
+                } else {
+                    if (value.integer < 0 || static_cast<uint64_t>(value.integer) > std::numeric_limits<T>::max()) {
+                        return false;
+                    }
+                }
+                target = static_cast<T>(value.integer);
+                return true;
+            case JsonBindScalar::Kind::UnsignedInteger:
+                if (value.unsignedInteger > static_cast<uint64_t>(std::numeric_limits<T>::max())) {
+                    return false;
+                }
+                target = static_cast<T>(value.unsignedInteger);
+                return true;
+            case JsonBindScalar::Kind::Double:
+                // Как у JsonValue::asInteger: допускается число без дробной части
+                if (std::trunc(value.real) != value.real
+                    || value.real < static_cast<double>(std::numeric_limits<T>::min())
+                    || value.real >= std::ldexp(1.0, std::numeric_limits<T>::digits)) {
+                    return false;
+                }
+                target = static_cast<T>(value.real);
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    template <typename T>
+    bool assignScalar(void *object, const JsonBindScalar &value)
+    {
+        T &target = *static_cast<T *>(object);
+        if constexpr (std::is_same_v<T, bool>) {
+            if (value.kind != JsonBindScalar::Kind::Bool) {
+                return false;
+            }
+            target = value.boolean;
+            return true;
+        } else if constexpr (std::is_integral_v<T>) {
+            return assignInteger(target, value);
+        } else if constexpr (std::is_floating_point_v<T>) {
+            switch (value.kind) {
+                case JsonBindScalar::Kind::Integer:
+                    target = static_cast<T>(value.integer);
+                    return true;
+                case JsonBindScalar::Kind::UnsignedInteger:
+                    target = static_cast<T>(value.unsignedInteger);
+                    return true;
+                case JsonBindScalar::Kind::Double:
+                    target = static_cast<T>(value.real);
+                    return true;
+                default:
+                    return false;
+            }
+        } else {
+            if (value.kind != JsonBindScalar::Kind::String) {
+                return false;
+            }
+            target.assign(value.string.data(), value.string.size());
+            return true;
+        }
+    }
+
+    template <typename T>
+    const JsonBindType &get();
+
+    template <typename T, size_t I>
+    JsonBindField makeField()
+    {
+        using Member = typename std::decay_t<decltype(std::get<I>(JsonBinding<T>::fields))>::MemberType;
+        return JsonBindField{
+            std::get<I>(JsonBinding<T>::fields).name,
+            &get<Member>,
+            [](void *object) -> void * {
+                return &(static_cast<T *>(object)->*(std::get<I>(JsonBinding<T>::fields).member));
+            },
+            !IsOptional<Member>::value
+        };
+    }
+
+    template <typename T, size_t... I>
+    const JsonBindField *makeFields(std::index_sequence<I...>)
+    {
+        static const std::array<JsonBindField, sizeof...(I)> fields{makeField<T, I>()...};
+        return fields.data();
+    }
+
+    // Ключи полей известны при компиляции, поэтому поле ищется совершенным хэшем
+    template <typename T, size_t... I>
+    size_t findField(std::string_view key)
+    {
+        static constexpr JsonPerfectHash<sizeof...(I)> keys{std::get<I>(JsonBinding<T>::fields).name...};
+        return keys.find(key);
+    }
+
+    template <typename T, size_t... I>
+    constexpr auto makeFindField(std::index_sequence<I...>)
+    {
+        return &findField<T, I...>;
+    }
+
+    template <typename T>
+    const JsonBindType &get()
+    {
+        if constexpr (IsVector<T>::value) {
+            using Element = typename T::value_type;
+            static_assert(!std::is_same_v<Element, bool>, "std::vector<bool> is not supported");
+            static const JsonBindType type{
+                JsonBindType::Kind::Vector, "array", nullptr, nullptr, 0, nullptr, &get<Element>,
+                [](void *object) { static_cast<T *>(object)->clear(); },
+                [](void *object) -> void * { return &static_cast<T *>(object)->emplace_back(); }
+            };
+            return type;
+        } else if constexpr (IsOptional<T>::value) {
+            using Value = typename T::value_type;
+            static const JsonBindType type{
+                JsonBindType::Kind::Optional, get<Value>().name, nullptr, nullptr, 0, nullptr, &get<Value>,
+                [](void *object) { static_cast<T *>(object)->reset(); },
+                [](void *object) -> void * { return &static_cast<T *>(object)->emplace(); }
+            };
+            return type;
+        } else if constexpr (std::is_arithmetic_v<T> || std::is_same_v<T, std::string>) {
+            static const JsonBindType type{
+                JsonBindType::Kind::Scalar,
+                std::is_same_v<T, bool> ? "boolean"
+                    : std::is_integral_v<T> ? "integer"
+                    : std::is_floating_point_v<T> ? "number" : "string",
+                &assignScalar<T>, nullptr, 0, nullptr, nullptr, nullptr, nullptr
+            };
+            return type;
+        } else {
+            constexpr size_t count = std::tuple_size_v<std::decay_t<decltype(JsonBinding<T>::fields)>>;
+            static_assert(count <= 64, "Too many fields");
+            static const JsonBindType type{
+                JsonBindType::Kind::Struct, "object", nullptr,
+                makeFields<T>(std::make_index_sequence<count>{}), count,
+                makeFindField<T>(std::make_index_sequence<count>{}), nullptr, nullptr, nullptr
+            };
+            return type;
+        }
+    }
+}
+
+class JsonBind
+{
+public:
+    template <typename T>
+    static T parse(const std::string &string)
+    {
+        return parse<T>(string.data(), string.data() + string.size());
+    }
+
+    template <typename T>
+    static T parse(const char *begin, const char *end)
+    {
+        T result{};
+        parse(&result, JsonBindTypes::get<T>(), begin, end);
+        return result;
+    }
+
+    // Разбор по отображенному в память файлу, как у Json::parseFile
+    template <typename T>
+    static T parseFile(const std::string &pathToFile)
+    {
+        T result{};
+        parseFile(&result, JsonBindTypes::get<T>(), pathToFile);
+        return result;
+    }
+
+private:
+    static void parse(void *object, const JsonBindType &type, const char *begin, const char *end);
+
+    static void parseFile(void *object, const JsonBindType &type, const std::string &pathToFile);
+};
\ No newline at end of file
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <any>
+#include <string>
+#include <string_view>
+
+#include "Json.hpp"
+#include "JsonHandler.hpp"
+#include "JsonValue.hpp"
+
+// Двоичное представление дерева Json и JsonValue в формате CBOR (RFC 8949).
+// Строки, массивы и объекты предваряются длиной, поэтому при чтении текст не сканируется
+// в поисках кавычек и скобок, а числа хранятся в двоичном виде и не требуют преобразования.
+// Пишутся только элементы определенной длины; целые значения double записываются как целые,
+// дробные - как float, если это без потерь, иначе как double. Если exactNumbers, double всегда
+// пишется как float или double, чтобы при чтении тип числа не сменился с Double на целый.
+// Читаются элементы определенной длины любого размера, семантические теги пропускаются.
+// Байтовые строки и элементы неопределенной длины не поддерживаются: генерируется
+// JsonParseUnexpectedChar, обрыв данных - JsonParseUnexpectedEof
+class JsonCbor
+{
+public:
+    [[nodiscard]] static std::string encode(const Json &json, bool exactNumbers = false);
+
+    // Дописать представление в конец строки
+    static void encode(const Json &json, std::string &output, bool exactNumbers = false);
+
+    [[nodiscard]] static std::string encode(const JsonValue &value, bool exactNumbers = false);
+
+    static void encode(const JsonValue &value, std::string &output, bool exactNumbers = false);
+
+    // Вход читается на месте, например из отображенного в память файла. Если preciseIntegers,
+    // целые числа хранятся как int64_t (или uint64_t, если больше INT64_MAX), как у Json::parse
+    static Json decode(std::string_view input, bool preciseIntegers = false);
+
+    // Разбор без построения дерева: события передаются обработчику handler, строки
+    // указывают прямо во вход
+    static void decode(std::string_view input, JsonHandler &handler);
+
+    static Json decodeFile(const std::string &pathToFile, bool preciseIntegers = false);
+
+private:
+    static void encodeJson(const Json &json, std::string &output, bool exactNumbers);
+
+    static void encodeAny(const std::any &value, std::string &output, bool exactNumbers);
+};
\ No newline at end of file
@@ -0,0 +1,262 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string_view>
+#include <vector>
+
+#include "JsonException.hpp"
+
+// Константы формата CBOR (RFC 8949), общие для чтения и записи
+namespace JsonCborFormat
+{
+    // Старшие три бита начального байта
+    enum Major : uint8_t
+    {
+        UNSIGNED = 0,
+        NEGATIVE = 1,
+        BYTES = 2,
+        TEXT = 3,
+        ARRAY = 4,
+        MAP = 5,
+        TAG = 6,
+        SIMPLE = 7
+    };
+
+    constexpr char FALSE_BYTE = '\xf4';
+    constexpr char TRUE_BYTE = '\xf5';
+    constexpr char NULL_BYTE = '\xf6';
+    constexpr char FLOAT_BYTE = '\xfa';
+    constexpr char DOUBLE_BYTE = '\xfb';
+
+    inline double decodeHalf(uint16_t half)
+    {
+        int exponent = (half >> 10) & 0x1f;
+        int mantissa = half & 0x3ff;
+
+        double value;
+        if (exponent == 0) {
+            value = std::ldexp(mantissa, -24);
+        } else if (exponent != 31) {
+            value = std::ldexp(mantissa + 1024, exponent - 25);
+        } else {
+            value = mantissa == 0 ? std::numeric_limits<double>::infinity() : std::numeric_limits<double>::quiet_NaN();
+        }
+        return (half & 0x8000) ? -value : value;
+    }
+}
+
+// Чтение CBOR (см. JsonCbor) с передачей событий обработчику Handler, как у JsonReader.
+// Вложенность обходится по явному стеку, поэтому глубина входа не ограничена размером стека потока
+template <typename Handler>
+class JsonCborReader
+{
+public:
+    JsonCborReader(const char *inputBegin, const char *inputEnd, Handler &inputHandler)
+        : position(inputBegin), end(inputEnd), handler(inputHandler)
+    {}
+
+    // Разбор элемента целиком. Как и в тексте, корнем может быть только объект или массив
+    void parseRoot()
+    {
+        uint8_t initial = readInitial();
+        if (initial >> 5 != JsonCborFormat::ARRAY && initial >> 5 != JsonCborFormat::MAP) {
+            throw JsonParseUnexpectedChar("Expected CBOR array or map");
+        }
+        readValue(initial);
+
+        while (!stack.empty()) {
+            Frame &top = stack.back();
+            if (top.remaining == 0) {
+                if (top.object) {
+                    handler.endObject();
+                } else {
+                    handler.endArray();
+                }
+                stack.pop_back();
+                continue;
+            }
+
+            // В объекте элементы чередуются: ключ, значение
+            bool isKey = top.object && top.remaining % 2 == 0;
+            top.remaining--;
+            if (isKey) {
+                readKey();
+                continue;
+            }
+            readValue(readInitial());
+        }
+
+        if (position != end) {
+            throw JsonParseUnexpectedChar("Unexpected data after CBOR item");
+        }
+    }
+
+private:
+    struct Frame
+    {
+        uint64_t remaining;     // Оставшиеся элементы; у объекта ключи и значения считаются отдельно
+        bool object;
+    };
+
+    [[nodiscard]] size_t available() const
+    {
+        return static_cast<size_t>(end - position);
+    }
+
+    uint64_t readBigEndian(size_t size)
+    {
+        if (available() < size) {
+            throw JsonParseUnexpectedEof("Unexpected end of CBOR data");
+        }
+
+        uint64_t value = 0;
+        for (size_t i = 0; i < size; i++) {
+            value = (value << 8) | static_cast<uint8_t>(position[i]);
+        }
+        position += size;
+        return value;
+    }
+
+    // Начальный байт следующего элемента; семантические теги пропускаются
+    uint8_t readInitial()
+    {
+        while (true) {
+            if (position == end) {
+                throw JsonParseUnexpectedEof("Unexpected end of CBOR data");
+            }
+            auto initial = static_cast<uint8_t>(*position++);
+            if (initial >> 5 != JsonCborFormat::TAG) {
+                return initial;
+            }
+            readArgument(initial & 0x1f);
+        }
+    }
+
+    uint64_t readArgument(uint8_t info)
+    {
+        if (info < 24) {
+            return info;
+        }
+        if (info <= 27) {
+            return readBigEndian(size_t{1} << (info - 24));
+        }
+        if (info == 31) {
+            throw JsonParseUnexpectedChar("Indefinite-length CBOR items are not supported");
+        }
+        throw JsonParseUnexpectedChar("Invalid CBOR additional information");
+    }
+
+    std::string_view readString(uint64_t size)
+    {
+        if (available() < size) {
+            throw JsonParseUnexpectedEof("Unexpected end of CBOR string");
+        }
+        std::string_view result(position, static_cast<size_t>(size));
+        position += size;
+        return result;
+    }
+
+    void readKey()
+    {
+        uint8_t initial = readInitial();
+        if (initial >> 5 != JsonCborFormat::TEXT) {
+            throw JsonParseUnexpectedChar("Expected CBOR text string as object key");
+        }
+        handler.key(readString(readArgument(initial & 0x1f)));
+    }
+
+    void readValue(uint8_t initial)
+    {
+        auto info = static_cast<uint8_t>(initial & 0x1f);
+        switch (initial >> 5) {
+            case JsonCborFormat::UNSIGNED: {
+                uint64_t value = readArgument(info);
+                if (value <= static_cast<uint64_t>(std::numeric_limits<int64_t>::max())) {
+                    handler.integer(static_cast<int64_t>(value));
+                } else {
+                    handler.unsignedInteger(value);
+                }
+                break;
+            }
+            case JsonCborFormat::NEGATIVE: {
+                // Значение -1 - value
+                uint64_t value = readArgument(info);
+                if (value <= static_cast<uint64_t>(std::numeric_limits<int64_t>::max())) {
+                    handler.integer(-1 - static_cast<int64_t>(value));
+                } else {
+                    handler.number(-1.0 - static_cast<double>(value));
+                }
+                break;
+            }
+            case JsonCborFormat::BYTES:
+                throw JsonParseUnexpectedChar("CBOR byte strings are not supported");
+            case JsonCborFormat::TEXT:
+                handler.string(readString(readArgument(info)));
+                break;
+            case JsonCborFormat::ARRAY: {
+                // Каждый элемент занимает хотя бы байт, поэтому длина проверяется сразу
+                uint64_t count = readArgument(info);
+                if (count > available()) {
+                    throw JsonParseUnexpectedEof("Unexpected end of CBOR array");
+                }
+                handler.startArray();
+                stack.push_back(Frame{count, false});
+                break;
+            }
+            case JsonCborFormat::MAP: {
+                uint64_t count = readArgument(info);
+                if (count > available() / 2) {
+                    throw JsonParseUnexpectedEof("Unexpected end of CBOR map");
+                }
+                handler.startObject();
+                stack.push_back(Frame{count * 2, true});
+                break;
+            }
+            default:
+                readSimple(info);
+        }
+    }
+
+    void readSimple(uint8_t info)
+    {
+        switch (info) {
+            case 20:
+                handler.boolean(false);
+                break;
+            case 21:
+                handler.boolean(true);
+                break;
+            case 22:
+            case 23:
+                handler.null();
+                break;
+            case 25:
+                handler.number(JsonCborFormat::decodeHalf(static_cast<uint16_t>(readBigEndian(2))));
+                break;
+            case 26: {
+                auto bits = static_cast<uint32_t>(readBigEndian(4));
+                float value;
+                std::memcpy(&value, &bits, sizeof(value));
+                handler.number(value);
+                break;
+            }
+            case 27: {
+                uint64_t bits = readBigEndian(8);
+                double value;
+                std::memcpy(&value, &bits, sizeof(value));
+                handler.number(value);
+                break;
+            }
+            default:
+                throw JsonParseUnexpectedChar("Unsupported CBOR simple value");
+        }
+    }
+
+    const char *position;
+    const char *end;
+    Handler &handler;
+    std::vector<Frame> stack;
+};
\ No newline at end of file
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "JsonArena.hpp"
+#include "JsonKeyPool.hpp"
+#include "JsonValue.hpp"
+
+// Документ, все значения, контейнеры и строки которого размещены в одной арене.
+// Во время разбора память выделяется сдвигом указателя, при уничтожении освобождается целиком
+// за O(1) от числа значений. Документ неизменяемый: значения доступны только для чтения.
+// Строки и ключи документа (asString, getKeys) действительны, пока жив документ.
+// Если задан пул keyPool, ключи объектов берутся из него (см. JsonKeyPool)
+class JsonDocument
+{
+public:
+    // Разбор документа из строки. Строка после разбора не нужна: все данные копируются в арену
+    static JsonDocument parse(const std::string &string, std::shared_ptr<JsonKeyPool> keyPool = nullptr);
+
+    static JsonDocument parse(const char *begin, const char *end, std::shared_ptr<JsonKeyPool> keyPool = nullptr);
+
+    // Разбор без копирования строк: строки и ключи без escape-последовательностей указывают прямо
+    // во входной буфер, в арену копируются только экранированные. Документ забирает строку себе
+    static JsonDocument parseInPlace(std::string &&string, std::shared_ptr<JsonKeyPool> keyPool = nullptr);
+
+    // То же для разделяемого буфера: документ удерживает его, пока жив сам
+    static JsonDocument parseInPlace(std::shared_ptr<const std::string> string,
+                                     std::shared_ptr<JsonKeyPool> keyPool = nullptr);
+
+    // Разбор файла без копирования: строки указывают в отображенный в память файл
+    static JsonDocument parseFile(const std::string &pathToFile, std::shared_ptr<JsonKeyPool> keyPool = nullptr);
+
+    // Документ, из которого переместили, пуст: корень null, getMemoryUsage() == 0, getInput() пуст
+    JsonDocument(JsonDocument &&document) noexcept;
+
+    JsonDocument &operator=(JsonDocument &&document) noexcept;
+
+    [[nodiscard]] const JsonValue &root() const
+    {
+        return rootValue;
+    }
+
+    // Сколько памяти занимает документ, без учета удерживаемого входного буфера
+    [[nodiscard]] size_t getMemoryUsage() const
+    {
+        return arena ? arena->getReservedSize() : 0;
+    }
+
+    // Удерживаемый входной буфер, пустой для документа, разобранного с копированием
+    [[nodiscard]] std::string_view getInput() const
+    {
+        return input;
+    }
+
+private:
+    friend class JsonParseCache;
+
+    JsonDocument() = default;
+
+    // Разбор input читателем Reader, строки остаются в буфере buffer.
+    // Определен для JsonReader (текст) и JsonCborReader (образ из JsonParseCache)
+    template <template <typename> class Reader>
+    static JsonDocument parsePinned(std::shared_ptr<const void> buffer, std::string_view input,
+                                    std::shared_ptr<JsonKeyPool> keyPool);
+
+    std::shared_ptr<const void> buffer;     // Владелец входного буфера при разборе без копирования
+    std::string_view input;
+    std::shared_ptr<JsonKeyPool> keys;      // Пул, в который указывают ключи объектов
+    std::unique_ptr<JsonArena> arena;
+    JsonValue rootValue;                    // Ничем не владеет, все данные в арене или буфере
+};
\ No newline at end of file
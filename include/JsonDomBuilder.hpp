@@ -0,0 +1,58 @@
+#pragma once
+
+#include <any>
+#include <memory>
+#include <vector>
+
+#include "Json.hpp"
+#include "JsonHandler.hpp"
+
+// Обработчик, строящий дерево Json по событиям парсера.
+// Дубликаты ключей обнаруживаются здесь, при получении события key
+class JsonDomBuilder final : public JsonHandler
+{
+public:
+    // Если precise, целые числа сохраняются как int64_t (или uint64_t, если больше INT64_MAX),
+    // иначе все числа сохраняются как double
+    explicit JsonDomBuilder(bool precise = false)
+        : preciseIntegers(precise)
+    {}
+
+    void startObject() override;
+
+    void key(std::string_view key) override;
+
+    void endObject() override;
+
+    void startArray() override;
+
+    void endArray() override;
+
+    void string(std::string_view value) override;
+
+    void number(double value) override;
+
+    void integer(int64_t value) override;
+
+    void unsignedInteger(uint64_t value) override;
+
+    void boolean(bool value) override;
+
+    void null() override;
+
+    // Забрать построенное дерево. Возвращает nullptr, если корень еще не был начат
+    Json *release()
+    {
+        return root.release();
+    }
+
+private:
+    void addValue(std::any &&value);
+
+    void startContainer(Json *json);
+
+    bool preciseIntegers;
+    std::unique_ptr<Json> root;
+    std::vector<Json *> stack;              // Открытые контейнеры, вершина - текущий
+    std::any *pendingSlot = nullptr;        // Место под значение последнего ключа
+};
\ No newline at end of file
@@ -60,4 +60,28 @@ class JsonParseDuplicatedKeyError: public JsonParseException
 {
 public:
     using JsonParseException::JsonParseException;
+};
+
+class JsonParseInvalidEscape: public JsonParseException
+{
+public:
+    using JsonParseException::JsonParseException;
+};
+
+class JsonWriteException : public JsonException
+{
+public:
+    using JsonException::JsonException;
+};
+
+class JsonPointerException : public JsonException
+{
+public:
+    using JsonException::JsonException;
+};
+
+class JsonBindException : public JsonException
+{
+public:
+    using JsonException::JsonException;
 };
\ No newline at end of file
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+// Содержимое файла только для чтения. Обычный файл отображается в память (mmap) с подсказкой
+// последовательного чтения, поэтому разбор начинается сразу и страницы не копируются в кучу.
+// Каналы и специальные файлы, которые нельзя отобразить, читаются в буфер вызовами read()
+class JsonFile
+{
+public:
+    // Если файл не удалось открыть или прочитать, генерируется JsonParseFileException
+    explicit JsonFile(const std::string &path);
+
+    JsonFile(JsonFile &&file) noexcept;
+
+    JsonFile &operator=(JsonFile &&file) noexcept;
+
+    JsonFile(const JsonFile &) = delete;
+
+    JsonFile &operator=(const JsonFile &) = delete;
+
+    ~JsonFile();
+
+    [[nodiscard]] const char *begin() const
+    {
+        return data;
+    }
+
+    [[nodiscard]] const char *end() const
+    {
+        return data + size;
+    }
+
+    [[nodiscard]] std::string_view view() const
+    {
+        return std::string_view(data, size);
+    }
+
+    // Файл отображен в память, а не прочитан в буфер
+    [[nodiscard]] bool isMapped() const
+    {
+        return mapped;
+    }
+
+private:
+    void readAll(int descriptor, size_t sizeHint, const std::string &path);
+
+    void unmap();
+
+    const char *data = nullptr;
+    size_t size = 0;
+    bool mapped = false;
+    std::string buffer;                     // Содержимое, если файл не отображен
+};
\ No newline at end of file
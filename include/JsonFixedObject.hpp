@@ -0,0 +1,198 @@
+#pragma once
+
+#include <array>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "JsonObject.hpp"
+#include "JsonPerfectHash.hpp"
+#include "JsonReader.hpp"
+#include "JsonValue.hpp"
+#include "JsonValueBuilder.hpp"
+
+// Объект с заранее известным набором ключей Keys (JsonPerfectHash со статическим временем жизни).
+// Значения хранятся в массиве по номеру ключа, поэтому доступ по ключу, известному при компиляции,
+// не ищет ничего во время выполнения:
+//
+//     static constexpr JsonPerfectHash KEYS{"ticker", "id", "description"};
+//     auto record = JsonFixedObject<KEYS>::parse(text);
+//     record.get<KEYS.indexOf("ticker")>().asString();
+//
+// При разборе ключ сопоставляется номеру одним хэшем и одним сравнением, значения остальных
+// ключей пропускаются без построения (грамматика при этом проверяется). Отсутствующий ключ дает null (см. contains)
+template <const auto &Keys>
+class JsonFixedObject
+{
+public:
+    static constexpr size_t SIZE = std::decay_t<decltype(Keys)>::getSize();
+
+    JsonFixedObject() = default;
+
+    // Значения известных ключей объекта object; если object не объект, генерируется JsonUnexpectedType
+    explicit JsonFixedObject(const JsonValue &object)
+    {
+        for (const JsonMember &member : object.asObject()) {
+            size_t index = Keys.find(member.key.asString());
+            if (index != Keys.NOT_FOUND) {
+                values[index] = member.value;
+                present[index] = true;
+            }
+        }
+    }
+
+    // Корнем должен быть объект. Ошибки разбора - те же исключения, что у JsonParser
+    static JsonFixedObject parse(const std::string &string)
+    {
+        return parse(string.data(), string.data() + string.size());
+    }
+
+    static JsonFixedObject parse(const char *begin, const char *end)
+    {
+        JsonFixedObject result;
+        Builder builder{result};
+        JsonReader<Builder>{begin, end, builder}.parseRoot();
+        return result;
+    }
+
+    template <size_t Index>
+    [[nodiscard]] const JsonValue &get() const
+    {
+        static_assert(Index < SIZE, "Key index is out of range");
+        return values[Index];
+    }
+
+    template <size_t Index>
+    JsonValue &get()
+    {
+        static_assert(Index < SIZE, "Key index is out of range");
+        return values[Index];
+    }
+
+    // Был ли ключ в объекте
+    template <size_t Index>
+    [[nodiscard]] bool contains() const
+    {
+        static_assert(Index < SIZE, "Key index is out of range");
+        return present[Index];
+    }
+
+    // Поиск по ключу, известному только во время выполнения. nullptr, если ключа нет
+    [[nodiscard]] const JsonValue *find(std::string_view key) const
+    {
+        size_t index = Keys.find(key);
+        return index != Keys.NOT_FOUND && present[index] ? &values[index] : nullptr;
+    }
+
+private:
+    // Обработчик событий корневого объекта; вложенные значения строит JsonValueBuilder
+    class Builder
+    {
+    public:
+        explicit Builder(JsonFixedObject &target)
+            : object(target)
+        {}
+
+        void startObject()
+        {
+            if (depth++ > 0) {
+                values.startObject();
+            }
+        }
+
+        void key(std::string_view key)
+        {
+            if (depth > 1) {
+                values.key(key);
+                return;
+            }
+            index = Keys.find(key);
+            if (index != Keys.NOT_FOUND && object.present[index]) {
+                throw JsonParseDuplicatedKeyError{"Duplicated key '" + std::string(key) + "'"};
+            }
+        }
+
+        void endObject()
+        {
+            if (--depth > 0) {
+                values.endObject();
+                finishValue();
+            }
+        }
+
+        void startArray()
+        {
+            if (depth++ == 0) {
+                throw JsonParseUnexpectedChar{"Expected JSON object"};
+            }
+            values.startArray();
+        }
+
+        void endArray()
+        {
+            depth--;
+            values.endArray();
+            finishValue();
+        }
+
+        void string(std::string_view value)
+        {
+            values.string(value);
+            finishValue();
+        }
+
+        void number(double value)
+        {
+            values.number(value);
+            finishValue();
+        }
+
+        void integer(int64_t value)
+        {
+            values.integer(value);
+            finishValue();
+        }
+
+        void unsignedInteger(uint64_t value)
+        {
+            values.unsignedInteger(value);
+            finishValue();
+        }
+
+        void boolean(bool value)
+        {
+            values.boolean(value);
+            finishValue();
+        }
+
+        void null()
+        {
+            values.null();
+            finishValue();
+        }
+
+        // Значение неизвестного ключа пропускается без событий
+        [[nodiscard]] bool isValueSkipped() const
+        {
+            return depth == 1 && index == Keys.NOT_FOUND;
+        }
+
+    private:
+        // Значение ключа корневого объекта готово
+        void finishValue()
+        {
+            if (depth == 1) {
+                object.values[index] = values.release();
+                object.present[index] = true;
+            }
+        }
+
+        JsonFixedObject &object;
+        JsonValueBuilder values;
+        size_t depth = 0;
+        size_t index = Keys.NOT_FOUND;
+    };
+
+    std::array<JsonValue, SIZE> values;
+    std::array<bool, SIZE> present{};
+};
\ No newline at end of file
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+// Низкоуровневое форматирование лексем JSON в буфер вызывающего
+namespace JsonFormat
+{
+    // Буфер под любое число
+    constexpr size_t MAX_NUMBER_SIZE = 32;
+
+    // Строка в кавычках после экранирования занимает не больше
+    constexpr size_t maxQuotedSize(size_t size)
+    {
+        return size * 6 + 2;
+    }
+
+    // Точный размер строки в кавычках после экранирования
+    size_t quotedSize(std::string_view string);
+
+    // Записать строку в кавычках с экранированием '"', '\' и управляющих символов.
+    // Участки без экранирования копируются целиком. Возвращает конец записанного
+    char *writeQuoted(char *out, std::string_view string);
+
+    // Кратчайшая запись, из которой double восстанавливается точно.
+    // Бесконечность и NaN в JSON не представимы и записываются как null
+    char *writeNumber(char *out, double value);
+
+    char *writeNumber(char *out, int64_t value);
+
+    char *writeNumber(char *out, uint64_t value);
+}
\ No newline at end of file
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+// Обработчик событий разбора (SAX-интерфейс).
+// Парсер вызывает методы по мере чтения документа, дерево Json при этом не строится.
+// Строки передаются через std::string_view, который действителен только до возврата из метода.
+class JsonHandler
+{
+public:
+    virtual void startObject() = 0;
+
+    // Ключ очередной пары объекта. Следом всегда идет событие значения
+    virtual void key(std::string_view key) = 0;
+
+    virtual void endObject() = 0;
+
+    virtual void startArray() = 0;
+
+    virtual void endArray() = 0;
+
+    virtual void string(std::string_view value) = 0;
+
+    virtual void number(double value) = 0;
+
+    // Целое число, помещающееся в int64_t. По умолчанию передается в number
+    virtual void integer(int64_t value)
+    {
+        number(static_cast<double>(value));
+    }
+
+    // Целое число больше INT64_MAX, помещающееся в uint64_t. По умолчанию передается в number
+    virtual void unsignedInteger(uint64_t value)
+    {
+        number(static_cast<double>(value));
+    }
+
+    virtual void boolean(bool value) = 0;
+
+    virtual void null() = 0;
+
+    virtual ~JsonHandler() = default;
+};
\ No newline at end of file
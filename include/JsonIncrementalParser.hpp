@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "JsonHandler.hpp"
+
+// Возобновляемый парсер: документ подается частями по мере чтения из сокета или канала,
+// события передаются обработчику сразу, как только очередная лексема разобрана целиком.
+// Состояние, включая недочитанную строку, число или ключевое слово, сохраняется между
+// вызовами feed, поэтому граница части может проходить где угодно.
+// Грамматика и исключения те же, что у JsonParser. После исключения парсер использовать нельзя
+class JsonIncrementalParser
+{
+public:
+    explicit JsonIncrementalParser(JsonHandler &eventHandler)
+        : handler(eventHandler)
+    {}
+
+    // Разобрать очередную часть документа
+    void feed(const char *data, size_t size);
+
+    void feed(std::string_view data)
+    {
+        feed(data.data(), data.size());
+    }
+
+    // Вход закончился. Если документ не завершен, генерируется JsonParseUnexpectedEof.
+    // После успешного завершения парсер готов к следующему документу
+    void finish();
+
+private:
+    // Чего ожидает парсер вне лексем
+    enum class State : uint8_t
+    {
+        Start,                              // Корень: объект или массив
+        Value,
+        ArrayFirst,                         // Значение или ']'
+        ObjectFirst,                        // Ключ или '}'
+        Key,
+        Colon,
+        AfterValue,                         // ',' или закрывающая скобка
+        Done,                               // Только пробельные символы
+    };
+
+    // Лексема, которая может не уместиться в одну часть
+    enum class Token : uint8_t
+    {
+        None,
+        String,
+        Number,
+        Keyword,
+    };
+
+    const char *parseStructure(const char *current, const char *end);
+
+    const char *beginValue(const char *current);
+
+    const char *continueString(const char *current, const char *end);
+
+    const char *continueNumber(const char *current, const char *end);
+
+    const char *continueKeyword(const char *current, const char *end);
+
+    void finishString(std::string_view raw);
+
+    void finishNumber(std::string_view text);
+
+    void closeContainer();
+
+    void valueDone()
+    {
+        state = containers.empty() ? State::Done : State::AfterValue;
+    }
+
+    JsonHandler &handler;
+    std::vector<char> containers;           // Открывающие скобки незакрытых контейнеров
+    State state = State::Start;
+    Token token = Token::None;
+
+    char quote = 0;                         // Открывающая кавычка текущей строки
+    bool stringIsKey = false;
+    bool escaped = false;                   // Предыдущий символ строки - '\'
+    bool hasEscapes = false;
+    std::string_view keyword;               // Ожидаемое ключевое слово и сколько его символов уже совпало
+    size_t keywordMatched = 0;
+
+    std::string pending;                    // Начало лексемы из предыдущих частей
+    std::string decoded;                    // Буфер для строк с экранированием
+};
\ No newline at end of file
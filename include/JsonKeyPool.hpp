@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstring>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_set>
+
+#include "JsonArena.hpp"
+
+// Пул ключей объектов. Каждый ключ хранится один раз вместе с заранее вычисленным хешем,
+// поэтому массивы однотипных объектов не копируют одни и те же ключи для каждого объекта,
+// а объекты не пересчитывают хеши ключей при построении индекса.
+// Пул может быть общим для нескольких документов (их ключи указывают в пул, поэтому
+// пул должен жить дольше документов - документ удерживает его через shared_ptr).
+// Если threadSafe, пул можно использовать при разборе из нескольких потоков одновременно
+class JsonKeyPool
+{
+public:
+    explicit JsonKeyPool(bool threadSafe = true)
+        : locking(threadSafe)
+    {}
+
+    JsonKeyPool(const JsonKeyPool &) = delete;
+
+    JsonKeyPool &operator=(const JsonKeyPool &) = delete;
+
+    // Постоянная копия ключа в пуле. Одинаковые ключи дают один и тот же адрес
+    std::string_view intern(std::string_view key);
+
+    // Хеш ключа, полученного из intern. Совпадает с JsonObject::hash
+    static size_t getHash(const char *interned)
+    {
+        size_t hash;
+        std::memcpy(&hash, interned - sizeof(size_t), sizeof(size_t));
+        return hash;
+    }
+
+    // Число разных ключей
+    [[nodiscard]] size_t getSize() const;
+
+    [[nodiscard]] size_t getMemoryUsage() const;
+
+private:
+    std::string_view insert(std::string_view key, size_t hash);
+
+    bool locking;
+    mutable std::shared_mutex mutex;
+    JsonArena arena{4096};
+    std::unordered_set<std::string_view> keys;
+};
\ No newline at end of file
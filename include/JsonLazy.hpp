@@ -0,0 +1,155 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "JsonValue.hpp"
+
+// Структурная разметка документа: позиции структурных символов, кавычек и начал лексем
+// и для каждой открывающей скобки - номер парной закрывающей
+struct JsonLazyTape
+{
+    std::shared_ptr<const void> buffer;     // Владелец входа
+    const char *end = nullptr;
+    std::vector<const char *> positions;
+    std::vector<uint32_t> closes;           // Для '[' и '{' - номер парной скобки в positions
+};
+
+// Значение ленивого документа. Массив или объект при разборе запоминает только свое место
+// в разметке, а его элементы разбираются при первом обращении к operator[], getKeys или getSize.
+// Вложенные контейнеры при этом пропускаются по разметке и разбираются при обращении к ним.
+// Ошибки внутри еще не разобранного контейнера обнаруживаются при первом обращении к нему.
+// Чтение из разных потоков безопасно: разобранные элементы публикуются атомарно
+class JsonLazyValue
+{
+public:
+    JsonLazyValue() = default;
+
+    JsonLazyValue(const JsonLazyValue &) = delete;
+
+    JsonLazyValue &operator=(const JsonLazyValue &) = delete;
+
+    ~JsonLazyValue();
+
+    [[nodiscard]] JsonValue::Type getType() const
+    {
+        return type;
+    }
+
+    [[nodiscard]] bool is_null() const
+    {
+        return type == JsonValue::Type::Null;
+    }
+
+    [[nodiscard]] bool is_array() const
+    {
+        return type == JsonValue::Type::Array;
+    }
+
+    [[nodiscard]] bool is_object() const
+    {
+        return type == JsonValue::Type::Object;
+    }
+
+    // Значения простых типов, см. JsonValue
+    [[nodiscard]] const JsonValue &asValue() const;
+
+    [[nodiscard]] bool asBool() const
+    {
+        return asValue().asBool();
+    }
+
+    [[nodiscard]] double asNumber() const
+    {
+        return asValue().asNumber();
+    }
+
+    [[nodiscard]] int64_t asInteger() const
+    {
+        return asValue().asInteger();
+    }
+
+    [[nodiscard]] std::string_view asString() const
+    {
+        return asValue().asString();
+    }
+
+    template <typename T>
+    [[nodiscard]] T get() const
+    {
+        return asValue().get<T>();
+    }
+
+    // Размер массива или объекта, для остальных типов 0
+    [[nodiscard]] size_t getSize() const;
+
+    [[nodiscard]] std::vector<std::string_view> getKeys() const;
+
+    const JsonLazyValue &operator[](std::string_view key) const;
+
+    const JsonLazyValue &operator[](const char *key) const
+    {
+        return (*this)[std::string_view(key)];
+    }
+
+    const JsonLazyValue &operator[](size_t index) const;
+
+    const JsonLazyValue &operator[](int index) const
+    {
+        return (*this)[static_cast<size_t>(index)];
+    }
+
+    // Разобрать поддерево целиком
+    [[nodiscard]] JsonValue toValue() const;
+
+private:
+    friend class JsonLazyDocument;
+
+    struct Children;
+
+    // Привязать значение к позиции разметки. Простые значения разбираются сразу
+    void initialize(const JsonLazyTape *valueTape, uint32_t valuePosition);
+
+    const Children &expand() const;
+
+    [[nodiscard]] Children *buildChildren() const;
+
+    const JsonLazyTape *tape = nullptr;
+    uint32_t position = 0;
+    JsonValue::Type type = JsonValue::Type::Null;
+    JsonValue scalar;                       // Значение простого типа
+    mutable std::atomic<Children *> children{nullptr};
+};
+
+// Ленивый документ: при разборе строится только структурная разметка, значения разбираются
+// по мере обращения к ним. Документ удерживает входной буфер, строки без экранирования
+// в нем не копируются
+class JsonLazyDocument
+{
+public:
+    static JsonLazyDocument parse(std::string &&string);
+
+    static JsonLazyDocument parseInPlace(std::shared_ptr<const std::string> string);
+
+    static JsonLazyDocument parseFile(const std::string &pathToFile);
+
+    JsonLazyDocument(JsonLazyDocument &&) noexcept = default;
+
+    JsonLazyDocument &operator=(JsonLazyDocument &&) noexcept = default;
+
+    [[nodiscard]] const JsonLazyValue &root() const
+    {
+        return *rootValue;
+    }
+
+private:
+    JsonLazyDocument() = default;
+
+    static JsonLazyDocument parsePinned(std::shared_ptr<const void> buffer, std::string_view input);
+
+    std::unique_ptr<JsonLazyTape> tape;
+    std::unique_ptr<JsonLazyValue> rootValue;
+};
\ No newline at end of file
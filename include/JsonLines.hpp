@@ -0,0 +1,38 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Json.hpp"
+
+// Разбор NDJSON (JSON Lines): каждая непустая строка входа - отдельный документ.
+// Вход делится по переводам строк на куски, которые разбираются параллельно на пуле потоков.
+// threads - число потоков, 0 - по числу ядер. При ошибке пробрасывается исключение
+// первой по порядку некорректной записи
+class JsonLines
+{
+public:
+    // Получатель записи: смещение начала записи во входе и сама запись.
+    // Вызывается одновременно из разных потоков и в произвольном порядке
+    using Callback = std::function<void(size_t offset, Json &&record)>;
+
+    // Записи в порядке входа
+    static std::vector<Json> parse(std::string_view input, unsigned threads = 0);
+
+    // Записи передаются callback по мере разбора, без накопления
+    static void parse(std::string_view input, const Callback &callback, unsigned threads = 0);
+
+    static std::vector<Json> parseFile(const std::string &pathToFile, unsigned threads = 0);
+
+    static void parseFile(const std::string &pathToFile, const Callback &callback, unsigned threads = 0);
+
+private:
+    // Разбиение входа на куски, заканчивающиеся переводом строки
+    static std::vector<std::string_view> split(std::string_view input, unsigned threads);
+
+    // Разобрать записи куска chunk, начинающегося со смещения offset
+    template <typename Consumer>
+    static void parseChunk(std::string_view chunk, size_t offset, const Consumer &consumer);
+};
\ No newline at end of file
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstdint>
+
+// Число JSON. Целые, помещающиеся в int64_t или uint64_t, хранятся без потери точности
+struct JsonNumber
+{
+    enum class Type : uint8_t
+    {
+        Integer,                // integer
+        UnsignedInteger,        // unsignedInteger, только если значение больше INT64_MAX
+        Double,                 // real
+    };
+
+    Type type = Type::Double;
+    union
+    {
+        int64_t integer;
+        uint64_t unsignedInteger;
+        double real = 0;
+    };
+
+    // Значение, приведенное к double
+    [[nodiscard]] double toDouble() const;
+
+    // Разбор числа строго по грамматике JSON: -?(0|[1-9][0-9]*)(.[0-9]+)?([eE][+-]?[0-9]+)?
+    // Читает прямо из буфера, без временной строки. Возвращает указатель на первый символ
+    // после числа или nullptr, если грамматика нарушена или число по модулю больше максимального
+    // double (1e400). Число меньше наименьшего double (1e-400) округляется до нуля со знаком
+    static const char *parse(const char *begin, const char *end, JsonNumber &number);
+};
\ No newline at end of file
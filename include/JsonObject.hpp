@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstdint>
+#include <memory_resource>
+#include <string_view>
+#include <utility>
+
+#include "JsonValue.hpp"
+
+// Плоское хранилище объекта JSON: пары лежат подряд в порядке вставки.
+// Пока пар немного, поиск линейный - для типичных объектов из 3-20 ключей это быстрее хеш-таблицы.
+// Начиная с INDEX_THRESHOLD пар строится индекс с открытой адресацией, поэтому поиск
+// и проверка дубликата при вставке стоят O(1) в среднем
+class JsonObject
+{
+public:
+    using MembersType = std::pmr::vector<JsonMember>;
+
+    static constexpr size_t INDEX_THRESHOLD = 16;
+
+    explicit JsonObject(std::pmr::memory_resource *resource)
+        : members(resource), index(resource)
+    {}
+
+    JsonObject(const JsonObject &object, std::pmr::memory_resource *resource);
+
+    // Хеш ключа. Совпадает для одинаковых ключей во всех объектах
+    static size_t hash(std::string_view key)
+    {
+        return std::hash<std::string_view>{}(key);
+    }
+
+    [[nodiscard]] size_t size() const
+    {
+        return members.size();
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+        return members.empty();
+    }
+
+    [[nodiscard]] MembersType::const_iterator begin() const
+    {
+        return members.cbegin();
+    }
+
+    [[nodiscard]] MembersType::const_iterator end() const
+    {
+        return members.cend();
+    }
+
+    MembersType::iterator begin()
+    {
+        return members.begin();
+    }
+
+    MembersType::iterator end()
+    {
+        return members.end();
+    }
+
+    void reserve(size_t size);
+
+    // Значение по ключу или nullptr
+    [[nodiscard]] const JsonValue *find(std::string_view key) const
+    {
+        return find(key, index.empty() ? 0 : hash(key));
+    }
+
+    JsonValue *find(std::string_view key)
+    {
+        return const_cast<JsonValue *>(static_cast<const JsonObject &>(*this).find(key));
+    }
+
+    // Поиск с заранее вычисленным хешем ключа (hash(key))
+    [[nodiscard]] const JsonValue *find(std::string_view key, size_t keyHash) const;
+
+    // Добавить ключ со значением null, если его еще нет.
+    // Возвращает место под значение и true, если ключ добавлен
+    std::pair<JsonValue *, bool> tryEmplace(JsonValue &&key);
+
+private:
+    struct Slot
+    {
+        uint32_t member;                    // Номер пары + 1, 0 - пустая ячейка
+        uint32_t hash;                      // Младшие биты хеша для быстрого отсева
+    };
+
+    [[nodiscard]] size_t findSlot(std::string_view key, size_t keyHash) const;
+
+    // Хеш ключа. У ключа из JsonKeyPool хеш уже вычислен
+    static size_t hashOf(const JsonValue &key);
+
+    // Ключи из одного пула равны, только если совпадают адреса
+    static bool equal(const JsonValue &left, const JsonValue &right);
+
+    void rebuildIndex(size_t capacity);
+
+    MembersType members;
+    std::pmr::vector<Slot> index;           // Пуст, пока пар меньше INDEX_THRESHOLD
+};
\ No newline at end of file
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <limits>
+#include <thread>
+#include <vector>
+
+// Параллельное выполнение независимых задач на пуле потоков
+namespace JsonParallel
+{
+    // Число потоков: threads или, если 0, число ядер
+    inline unsigned threadCount(unsigned threads)
+    {
+        return threads ? threads : std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    // Выполнить task(0), ..., task(count - 1) на threads потоках (вызывающий поток тоже работает).
+    // Задачи разбираются по порядку. Если задачи генерируют исключения, после завершения всех
+    // потоков пробрасывается исключение задачи с наименьшим номером, а задачи с большими номерами
+    // после первой ошибки уже не запускаются
+    template <typename Task>
+    void forEach(size_t count, unsigned threads, const Task &task)
+    {
+        std::atomic<size_t> next{0};
+        std::atomic<size_t> failed{std::numeric_limits<size_t>::max()};
+        std::vector<std::exception_ptr> errors(count);
+
+        auto worker = [&]() {
+            for (size_t i = next++; i < count; i = next++) {
+                if (i > failed.load(std::memory_order_relaxed)) {
+                    continue;
+                }
+                try {
+                    task(i);
+                } catch (...) {
+                    errors[i] = std::current_exception();
+                    size_t expected = failed.load();
+                    while (i < expected && !failed.compare_exchange_weak(expected, i)) {}
+                }
+            }
+        };
+
+        size_t workers = std::min<size_t>(threadCount(threads), count);
+        std::vector<std::thread> pool;
+        if (workers > 1) {
+            pool.reserve(workers - 1);
+            for (size_t i = 1; i < workers; i++) {
+                pool.emplace_back(worker);
+            }
+        }
+        worker();
+        for (std::thread &thread : pool) {
+            thread.join();
+        }
+
+        if (failed != std::numeric_limits<size_t>::max()) {
+            std::rethrow_exception(errors[failed]);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "Json.hpp"
+#include "JsonDocument.hpp"
+
+// Кэш разобранных файлов на диске. После первого разбора рядом с файлом (или в каталоге кэша)
+// сохраняется образ документа в CBOR с заголовком: размер, время изменения и хэш содержимого
+// исходного файла, а также хэш самого образа. Следующие загрузки отображают образ в память
+// и читают его без разбора текста (см. JsonCbor). Устаревший или поврежденный образ перестраивается.
+// Ошибки записи кэша не мешают разбору: документ возвращается и без сохранения образа
+class JsonParseCache
+{
+public:
+    // Если directory пуст, образ сохраняется рядом с файлом с суффиксом EXTENSION,
+    // иначе в directory (каталог создается) под именем, полученным из абсолютного пути файла
+    explicit JsonParseCache(std::string directory = {})
+        : cacheDirectory(std::move(directory))
+    {}
+
+    // Аналог Json::parseFile, в том числе по типам чисел при любом preciseIntegers.
+    // Можно вызывать одновременно из разных потоков
+    Json parseFile(const std::string &pathToFile, bool preciseIntegers = false);
+
+    // Аналог JsonDocument::parseFile; как и у него, целые числа всегда точные. Самый быстрый
+    // способ загрузки: при попадании строки документа указывают прямо в отображенный образ,
+    // а дерево Json не строится
+    JsonDocument parseDocument(const std::string &pathToFile, std::shared_ptr<JsonKeyPool> keyPool = nullptr);
+
+    // Путь к образу файла pathToFile
+    [[nodiscard]] std::string getCachePath(const std::string &pathToFile) const;
+
+    // Число загрузок из образа и разборов текста
+    [[nodiscard]] size_t getHits() const
+    {
+        return hits;
+    }
+
+    [[nodiscard]] size_t getMisses() const
+    {
+        return misses;
+    }
+
+    static constexpr const char *EXTENSION = ".jsoncache";
+
+private:
+    std::string cacheDirectory;
+    std::atomic<size_t> hits{0};
+    std::atomic<size_t> misses{0};
+};
\ No newline at end of file
@@ -1,36 +1,27 @@
 #pragma once
 
-#include <stack>
-#include <functional>
-#include <memory>
-#include <list>
+#include <string>
 #include "Json.hpp"
+#include "JsonHandler.hpp"
 
 class JsonParser
 {
 public:
-    using PartsType = std::list<std::any>;
+    // Разбор с построением дерева. Если preciseIntegers, целые числа сохраняются как int64_t
+    // (или uint64_t, если больше INT64_MAX) без округления до double, см. JsonDomBuilder
+    static Json *parse(const std::string &string, bool preciseIntegers = false);
 
-    static Json *parse(const std::string &string);
+    static Json *parse(const char *begin, const char *end, bool preciseIntegers = false);
 
-private:
-    static PartsType fullSplit(const std::string &input);
+    // Разбор с построением дерева, при котором элементы корневого массива делятся на диапазоны
+    // предварительным проходом по структурному индексу и разбираются на threads потоках.
+    // Небольшие документы и документы с корнем-объектом разбираются последовательно.
+    // При ошибке документ разбирается заново последовательно, чтобы исключение совпало с parse
+    static Json *parseParallel(const char *begin, const char *end, unsigned threads = 0,
+                               bool preciseIntegers = false);
 
-    static std::optional<std::any>
-    ejectString(std::string::const_iterator &iterator, const std::string::const_iterator &end);
+    // Разбор без построения дерева: события передаются обработчику handler
+    static void parse(const std::string &string, JsonHandler &handler);
 
-    static std::optional<std::any>
-    ejectNumber(std::string::const_iterator &iterator, const std::string::const_iterator &end);
-
-    static std::optional<std::any>
-    ejectKeyword(std::string::const_iterator &iterator, const std::string::const_iterator &end);
-
-    static std::any
-    parsePart(PartsType::const_iterator &iterator, const PartsType::const_iterator &end, bool inStart = true);
-
-    static Json *
-    parseArray(PartsType::const_iterator &iterator, const PartsType::const_iterator &end);
-
-    static Json *
-    parseObject(PartsType::const_iterator &iterator, const PartsType::const_iterator &end);
+    static void parse(const char *begin, const char *end, JsonHandler &handler);
 };
\ No newline at end of file
@@ -0,0 +1,197 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+#include "JsonException.hpp"
+
+// Совершенный хэш над набором ключей, известным при компиляции:
+//
+//     constexpr JsonPerfectHash KEYS{"ticker", "id", "description"};
+//     KEYS.find(key);                  // Номер ключа в списке или NOT_FOUND
+//     KEYS.indexOf("id");              // То же при компиляции; неизвестный ключ - ошибка компиляции
+//
+// Таблица строится в constexpr-конструкторе методом hash-and-displace: ключи делятся по корзинам,
+// и для каждой корзины, начиная с самых больших, подбирается смещение, при котором ее ключи
+// попадают в свободные ячейки. Подбор идет по корзинам, а не по всему набору сразу, поэтому
+// построение почти линейно по числу ключей. Поиск - один проход по строке, два перемешивания
+// хэша и одно сравнение
+template <size_t N>
+class JsonPerfectHash
+{
+public:
+    static_assert(N < 255, "Too many keys");
+
+    static constexpr size_t SIZE = N;
+    static constexpr size_t NOT_FOUND = static_cast<size_t>(-1);
+
+    template <typename... Keys,
+              typename = std::enable_if_t<(std::is_convertible_v<Keys, std::string_view> && ...)>>
+    constexpr explicit JsonPerfectHash(Keys... keyList)
+        : JsonPerfectHash(std::array<std::string_view, N>{std::string_view(keyList)...})
+    {}
+
+    constexpr explicit JsonPerfectHash(const std::array<std::string_view, N> &keyList)
+        : keys(keyList)
+    {
+        for (size_t i = 0; i < N; i++) {
+            for (size_t j = i + 1; j < N; j++) {
+                if (keys[i] == keys[j]) {
+                    throw JsonException("Duplicated key in perfect hash");
+                }
+            }
+        }
+
+        // Другое зерно нужно, только если у разных ключей совпали все 64 бита хэша
+        for (uint64_t candidate = 0; candidate < MAX_SEEDS; candidate++) {
+            if (build(candidate)) {
+                return;
+            }
+        }
+        throw JsonException("Cannot build perfect hash");
+    }
+
+    [[nodiscard]] constexpr size_t find(std::string_view key) const
+    {
+        uint64_t keyHash = hash(key, seed);
+        uint8_t slot = table[slotOf(keyHash, displacements[keyHash & BUCKET_MASK])];
+        return slot != 0 && keys[slot - 1] == key ? slot - 1 : NOT_FOUND;
+    }
+
+    // Для использования в константных выражениях: get<KEYS.indexOf("id")>()
+    [[nodiscard]] constexpr size_t indexOf(std::string_view key) const
+    {
+        size_t index = find(key);
+        if (index == NOT_FOUND) {
+            throw JsonUnexpectedKey("Unknown key");
+        }
+        return index;
+    }
+
+    [[nodiscard]] constexpr std::string_view getKey(size_t index) const
+    {
+        return keys[index];
+    }
+
+    [[nodiscard]] static constexpr size_t getSize()
+    {
+        return N;
+    }
+
+private:
+    static constexpr size_t powerOfTwo(size_t count)
+    {
+        size_t result = 1;
+        while (result < count) {
+            result *= 2;
+        }
+        return result;
+    }
+
+    // В среднем два ключа на корзину, таблица заполнена не больше чем наполовину
+    static constexpr size_t BUCKET_COUNT = powerOfTwo((N + 1) / 2);
+    static constexpr size_t BUCKET_MASK = BUCKET_COUNT - 1;
+    static constexpr size_t TABLE_SIZE = powerOfTwo(N) * 2;
+    static constexpr uint64_t MAX_SEEDS = 16;
+    static constexpr uint32_t MAX_DISPLACEMENT = 1 << 12;
+
+    // FNV-1a с зерном и перемешиванием старших битов в младшие, по которым берется корзина
+    static constexpr uint64_t hash(std::string_view key, uint64_t hashSeed)
+    {
+        uint64_t result = 14695981039346656037ULL ^ (hashSeed * 0x9e3779b97f4a7c15ULL);
+        for (char c : key) {
+            result ^= static_cast<uint8_t>(c);
+            result *= 1099511628211ULL;
+        }
+        return mix(result);
+    }
+
+    static constexpr uint64_t mix(uint64_t value)
+    {
+        value ^= value >> 32;
+        value *= 0xd6e8feb86659fd93ULL;
+        value ^= value >> 32;
+        return value;
+    }
+
+    // Ячейка ключа с хэшем keyHash при смещении его корзины displacement
+    static constexpr size_t slotOf(uint64_t keyHash, uint32_t displacement)
+    {
+        return mix(keyHash + displacement * 0x9e3779b97f4a7c15ULL) & (TABLE_SIZE - 1);
+    }
+
+    constexpr bool build(uint64_t candidate)
+    {
+        std::array<uint64_t, N> hashes{};
+        std::array<size_t, BUCKET_COUNT> bucketSizes{};
+        size_t maxBucketSize = 0;
+        for (size_t i = 0; i < N; i++) {
+            hashes[i] = hash(keys[i], candidate);
+            size_t bucketSize = ++bucketSizes[hashes[i] & BUCKET_MASK];
+            maxBucketSize = bucketSize > maxBucketSize ? bucketSize : maxBucketSize;
+        }
+
+        for (uint8_t &slot : table) {
+            slot = 0;
+        }
+        for (size_t bucketSize = maxBucketSize; bucketSize > 0; bucketSize--) {
+            for (size_t bucket = 0; bucket < BUCKET_COUNT; bucket++) {
+                if (bucketSizes[bucket] == bucketSize && !place(hashes, bucket)) {
+                    return false;
+                }
+            }
+        }
+        seed = candidate;
+        return true;
+    }
+
+    // Подобрать смещение, при котором все ключи корзины попадают в разные свободные ячейки
+    constexpr bool place(const std::array<uint64_t, N> &hashes, size_t bucket)
+    {
+        for (uint32_t displacement = 0; displacement < MAX_DISPLACEMENT; displacement++) {
+            size_t placed = 0;
+            bool fits = true;
+            for (size_t i = 0; i < N && fits; i++) {
+                if ((hashes[i] & BUCKET_MASK) != bucket) {
+                    continue;
+                }
+                uint8_t &slot = table[slotOf(hashes[i], displacement)];
+                if (slot != 0) {
+                    fits = false;
+                } else {
+                    slot = static_cast<uint8_t>(i + 1);
+                    placed++;
+                }
+            }
+            if (fits) {
+                displacements[bucket] = displacement;
+                return true;
+            }
+
+            // Откат частично размещенной корзины
+            for (size_t i = 0; i < N && placed > 0; i++) {
+                if ((hashes[i] & BUCKET_MASK) == bucket) {
+                    uint8_t &slot = table[slotOf(hashes[i], displacement)];
+                    if (slot == i + 1) {
+                        slot = 0;
+                        placed--;
+                    }
+                }
+            }
+        }
+        return false;
+    }
+
+    std::array<std::string_view, N> keys{};
+    std::array<uint8_t, TABLE_SIZE> table{};                // Номер ключа + 1, 0 - пустой слот
+    std::array<uint16_t, BUCKET_COUNT> displacements{};
+    uint64_t seed = 0;
+};
+
+template <typename... Keys>
+JsonPerfectHash(Keys...) -> JsonPerfectHash<sizeof...(Keys)>;
+
+template <size_t N>
+JsonPerfectHash(std::array<std::string_view, N>) -> JsonPerfectHash<N>;
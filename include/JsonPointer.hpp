@@ -0,0 +1,93 @@
+#pragma once
+
+#include <any>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Json.hpp"
+#include "JsonValue.hpp"
+
+// Указатель JSON (RFC 6901), например "/address/city" или "/marks/0".
+// Путь разбирается один раз: ключи хранятся готовыми строками с вычисленным хешем,
+// номера элементов массива - числами, поэтому один указатель можно многократно применять
+// к разным документам, и каждый шаг пути - это один поиск
+class JsonPointer
+{
+public:
+    // Если строка не является указателем JSON, генерируется JsonPointerException
+    explicit JsonPointer(std::string_view pointer);
+
+    // Число шагов пути. У пустого указателя, обозначающего весь документ, 0
+    [[nodiscard]] size_t getSize() const
+    {
+        return tokens.size();
+    }
+
+    [[nodiscard]] std::string toString() const;
+
+    // Значение по пути или nullptr, если пути в документе нет
+    [[nodiscard]] const JsonValue *find(const JsonValue &value) const;
+
+    // Для дерева Json результат - значение внутри объекта или массива, поэтому
+    // для пустого указателя возвращается nullptr. Поиск только читает дерево: данные копий
+    // не клонируются, и найденный вложенный Json доступен только для чтения
+    [[nodiscard]] const std::any *find(const Json &json) const;
+
+    // Значение по пути. Если пути нет, генерируется JsonUnexpectedKey
+    [[nodiscard]] const JsonValue &get(const JsonValue &value) const;
+
+private:
+    friend class JsonPointerBatch;
+
+    struct Token
+    {
+        std::string key;
+        size_t hash;                        // JsonObject::hash(key)
+        size_t index;                       // Номер элемента, если isIndex
+        bool isIndex;
+
+        bool operator==(const Token &token) const
+        {
+            return key == token.key;
+        }
+    };
+
+    static const JsonValue *step(const JsonValue &value, const Token &token);
+
+    static const std::any *step(const Json &json, const Token &token);
+
+    // Json, на который указывает значение, или nullptr
+    static const Json *asJson(const std::any *value);
+
+    std::vector<Token> tokens;
+};
+
+// Набор указателей, которые вычисляются за один обход документа: общие начала путей
+// хранятся деревом (префиксным) и проходятся один раз
+class JsonPointerBatch
+{
+public:
+    explicit JsonPointerBatch(const std::vector<JsonPointer> &pointers);
+
+    // Результаты в порядке указателей, nullptr для отсутствующих путей
+    [[nodiscard]] std::vector<const JsonValue *> find(const JsonValue &value) const;
+
+    [[nodiscard]] std::vector<const std::any *> find(const Json &json) const;
+
+private:
+    struct Node
+    {
+        JsonPointer::Token token;
+        std::vector<size_t> children;
+        std::vector<size_t> results;        // Номера указателей, заканчивающихся в этом узле
+    };
+
+    void walk(size_t node, const JsonValue *value, std::vector<const JsonValue *> &results) const;
+
+    // json - дерево, на которое указывает value (у корня value нет)
+    void walk(size_t node, const Json *json, const std::any *value, std::vector<const std::any *> &results) const;
+
+    std::vector<Node> nodes;                // nodes[0] - корень документа
+    size_t pointerCount;
+};
\ No newline at end of file
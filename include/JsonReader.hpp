@@ -0,0 +1,376 @@
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "JsonException.hpp"
+#include "JsonNumber.hpp"
+#include "JsonString.hpp"
+#include "JsonStructuralIndex.hpp"
+#include "Utils.hpp"
+
+// Ядро парсера: однопроходный рекурсивный спуск по входным символам.
+// Переходы между лексемами и поиск концов строк выполняются по структурному индексу,
+// поэтому пробелы и содержимое строк побайтно не просматриваются.
+// Результат разбора передается обработчику Handler в виде событий (см. JsonHandler).
+// Handler может быть как наследником JsonHandler, так и любым классом с теми же методами -
+// в этом случае вызовы не виртуальные. Если у Handler есть метод bool isValueSkipped(), он
+// вызывается после каждого ключа: значение ненужного ключа пропускается без событий.
+template <typename Handler>
+class JsonReader
+{
+public:
+    JsonReader(const char *inputBegin, const char *inputEnd, Handler &inputHandler)
+        : current(inputBegin), end(inputEnd), handler(inputHandler), index(inputBegin, inputEnd)
+    {}
+
+    // Разбор документа целиком. Корнем документа может быть только объект или массив
+    void parseRoot()
+    {
+        char first = peek("Expected start of JSON");
+        if (first != '[' && first != '{') {
+            throw JsonParseUnexpectedChar{"Expected start of JSON"};
+        }
+
+        parseValue();
+        parseEnd();
+    }
+
+    // После значения до конца входа - только пробелы
+    void parseEnd()
+    {
+        skipSpaces();
+        if (current != end) {
+            throw JsonParseUnexpectedChar{"Excepted end of JSON"};
+        }
+    }
+
+    // Разбор значений через запятую до конца входа: часть элементов массива без скобок
+    void parseElements()
+    {
+        while (true) {
+            parseValue();
+
+            skipSpaces();
+            if (current == end) {
+                return;
+            }
+            if (*current++ != ',') {
+                throw JsonParseUnexpectedChar{"Expected ','"};
+            }
+        }
+    }
+
+    void parseValue()
+    {
+        char c = peek("Expected value");
+
+        if (c == '[') {
+            parseArray();
+        } else if (c == '{') {
+            parseObject();
+        } else if (Utils::isCharQuote(c)) {
+            handler.string(parseString());
+        } else if (Utils::isCharNumber(c)) {
+            parseNumber();
+        } else {
+            parseKeyword();
+        }
+    }
+
+    // Пошаговый обход массива без событий о самом массиве: enterArray пропускает '[',
+    // nextElement - запятую перед очередным элементом, после чего элемент разбирается parseValue
+    // или пропускается skipValue. Когда элементы кончились, nextElement пропускает ']' и возвращает false
+    void enterArray()
+    {
+        if (peek("Expected array") != '[') {
+            throw JsonParseUnexpectedChar{"Expected array"};
+        }
+        current++;
+        firstElement = true;
+    }
+
+    bool nextElement()
+    {
+        char c = peek("Expected end of array");
+        bool first = std::exchange(firstElement, false);
+        if (c == ']') {
+            current++;
+            return false;
+        }
+        if (!first) {
+            if (c != ',') {
+                throw JsonParseUnexpectedChar{"Expected ','"};
+            }
+            current++;
+        }
+        return true;
+    }
+
+    // Пропуск значения без событий. Грамматика проверяется так же строго, как при разборе:
+    // парность скобок, запятые и двоеточия, ключевые слова, числа и экранирование в строках.
+    // Не выполняется только передача значений обработчику. Вложенность отслеживается
+    // стеком видов скобок, без рекурсии
+    void skipValue()
+    {
+        enum class Expect : uint8_t
+        {
+            Value,
+            ValueOrEnd,                     // Первый элемент массива или ']'
+            Key,
+            KeyOrEnd,                       // Первый ключ объекта или '}'
+            Colon,
+            CommaOrEnd,
+        };
+
+        skipStack.clear();
+        Expect expect = Expect::Value;
+        while (true) {
+            char c = peek(expect == Expect::CommaOrEnd ? "Expected end of value" : "Expected value");
+            bool closes = (c == ']' && (expect == Expect::ValueOrEnd || expect == Expect::CommaOrEnd)
+                           && skipStack.back() == '[')
+                          || (c == '}' && (expect == Expect::KeyOrEnd || expect == Expect::CommaOrEnd)
+                              && skipStack.back() == '{');
+
+            if (closes) {
+                current++;
+                skipStack.pop_back();
+            } else if (expect == Expect::CommaOrEnd) {
+                if (c != ',') {
+                    throw JsonParseUnexpectedChar{"Expected ','"};
+                }
+                current++;
+                expect = skipStack.back() == '[' ? Expect::Value : Expect::Key;
+                continue;
+            } else if (expect == Expect::Colon) {
+                if (c != ':') {
+                    throw JsonParseUnexpectedChar{"Expected ':'"};
+                }
+                current++;
+                expect = Expect::Value;
+                continue;
+            } else if (expect == Expect::Key || expect == Expect::KeyOrEnd) {
+                if (!Utils::isCharQuote(c)) {
+                    throw JsonParseUnexpectedChar{"Expected key"};
+                }
+                parseString();
+                expect = Expect::Colon;
+                continue;
+            } else if (c == '[' || c == '{') {
+                current++;
+                skipStack.push_back(c);
+                expect = c == '[' ? Expect::ValueOrEnd : Expect::KeyOrEnd;
+                continue;
+            } else if (Utils::isCharQuote(c)) {
+                parseString();
+            } else if (Utils::isCharNumber(c)) {
+                JsonNumber number;
+                scanNumber(number);
+            } else {
+                scanKeyword();
+            }
+
+            // Значение закончилось
+            if (skipStack.empty()) {
+                return;
+            }
+            expect = Expect::CommaOrEnd;
+        }
+    }
+
+private:
+    template <typename T, typename = void>
+    struct CanSkip : std::false_type
+    {};
+
+    template <typename T>
+    struct CanSkip<T, std::void_t<decltype(std::declval<T &>().isValueSkipped())>> : std::true_type
+    {};
+
+    void parseArray()
+    {
+        // Открывающая скобка уже проверена в peek
+        current++;
+        handler.startArray();
+
+        if (peek("Expected end of array") == ']') {
+            current++;
+            handler.endArray();
+            return;
+        }
+
+        while (true) {
+            parseValue();
+
+            char c = peek("Expected end of array");
+            current++;
+            if (c == ']') {
+                handler.endArray();
+                return;
+            }
+            if (c != ',') {
+                throw JsonParseUnexpectedChar{"Expected ','"};
+            }
+        }
+    }
+
+    void parseObject()
+    {
+        // Открывающая скобка уже проверена в peek
+        current++;
+        handler.startObject();
+
+        if (peek("Expected end of object") == '}') {
+            current++;
+            handler.endObject();
+            return;
+        }
+
+        while (true) {
+            if (!Utils::isCharQuote(peek("Expected key"))) {
+                throw JsonParseUnexpectedChar{"Expected key"};
+            }
+
+            handler.key(parseString());
+            if (peek("Expected ':'") != ':') {
+                throw JsonParseUnexpectedChar{"Expected ':'"};
+            }
+            current++;
+
+            if constexpr (CanSkip<Handler>::value) {
+                if (handler.isValueSkipped()) {
+                    skipValue();
+                } else {
+                    parseValue();
+                }
+            } else {
+                parseValue();
+            }
+
+            char c = peek("Expected end of object");
+            current++;
+            if (c == '}') {
+                handler.endObject();
+                return;
+            }
+            if (c != ',') {
+                throw JsonParseUnexpectedChar{"Expected ','"};
+            }
+        }
+    }
+
+    // Возвращает строку без кавычек. Если в строке нет экранирования, результат указывает
+    // прямо во входной буфер, иначе - в buffer
+    std::string_view parseString()
+    {
+        char openQuote = *current++;
+        const char *stringEnd = index.next(current);
+        if (stringEnd == end) {
+            throw JsonParseUnexpectedEof{"Expected end of the string"};
+        }
+        if (*stringEnd != openQuote) {
+            throw JsonParseInternalError{"Structural index is out of sync"};
+        }
+
+        const char *spanStart = current;
+        current = stringEnd + 1;
+
+        auto length = static_cast<size_t>(stringEnd - spanStart);
+        if (!std::memchr(spanStart, '\\', length)) {
+            return std::string_view(spanStart, length);
+        }
+
+        JsonString::decode(spanStart, stringEnd, buffer);
+        return buffer;
+    }
+
+    void parseNumber()
+    {
+        JsonNumber number;
+        scanNumber(number);
+
+        switch (number.type) {
+            case JsonNumber::Type::Integer:
+                handler.integer(number.integer);
+                break;
+            case JsonNumber::Type::UnsignedInteger:
+                handler.unsignedInteger(number.unsignedInteger);
+                break;
+            default:
+                handler.number(number.real);
+                break;
+        }
+    }
+
+    // Число без передачи обработчику
+    void scanNumber(JsonNumber &number)
+    {
+        const char *numberEnd = JsonNumber::parse(current, end, number);
+
+        // Число должно заканчиваться там, где заканчивается грамматика: "1.2.3" или "01" - ошибка
+        if (!numberEnd || (numberEnd != end && Utils::isCharNumber(*numberEnd))) {
+            const char *runEnd = std::find_if_not(current, end, Utils::isCharNumber);
+            throw JsonParseCannotParseNumber{"Cannot parse number '" + std::string(current, runEnd) + "'"};
+        }
+        current = numberEnd;
+    }
+
+    void parseKeyword()
+    {
+        switch (scanKeyword()) {
+            case 't':
+                handler.boolean(true);
+                break;
+            case 'f':
+                handler.boolean(false);
+                break;
+            default:
+                handler.null();
+                break;
+        }
+    }
+
+    // Ключевое слово без передачи обработчику. Возвращает его первую букву
+    char scanKeyword()
+    {
+        auto length = static_cast<size_t>(end - current);
+        for (std::string_view keyword : {"true", "false", "null"}) {
+            if (length >= keyword.size() && std::equal(keyword.cbegin(), keyword.cend(), current)) {
+                current += keyword.size();
+                return keyword.front();
+            }
+        }
+        throw JsonParseUnexpectedChar{"Unexpected char '" + std::string{*current} + "'"};
+    }
+
+    // Пропускает пробельные символы и возвращает следующий символ.
+    // Если вход закончился, генерируется JsonParseUnexpectedEof с сообщением message
+    char peek(const char *message)
+    {
+        skipSpaces();
+        if (current == end) {
+            throw JsonParseUnexpectedEof{message};
+        }
+        return *current;
+    }
+
+    // Первый непробельный символ после пробела вне строки всегда есть в индексе
+    void skipSpaces()
+    {
+        if (current != end && Utils::isCharSpace(*current)) {
+            current = index.next(current);
+        }
+    }
+
+    const char *current;
+    const char *end;
+    Handler &handler;
+    JsonStructuralIndex index;
+    std::string buffer;                     // Буфер для строк с экранированием
+    std::string skipStack;                  // Открытые скобки пропускаемого значения
+    bool firstElement = false;              // nextElement еще не вызывался в текущем массиве
+};
\ No newline at end of file
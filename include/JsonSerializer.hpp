@@ -0,0 +1,40 @@
+#pragma once
+
+#include <any>
+#include <ostream>
+#include <string>
+
+#include "Json.hpp"
+
+// Запись дерева Json в текст. Сначала вычисляется точный размер результата, поэтому строка
+// выделяется один раз. В поток текст пишется через буфер фиксированного размера.
+// Если indent < 0, вывод компактный, иначе каждый элемент с новой строки с отступом indent пробелов
+class JsonSerializer
+{
+public:
+    explicit JsonSerializer(int indentSize = -1)
+        : indent(indentSize)
+    {}
+
+    // Точный размер текста
+    [[nodiscard]] size_t getSize(const Json &json) const;
+
+    [[nodiscard]] std::string dump(const Json &json) const;
+
+    // Дописать текст в конец строки
+    void dump(const Json &json, std::string &output) const;
+
+    void write(const Json &json, std::ostream &stream) const;
+
+private:
+    template <typename Output>
+    void writeJson(const Json &json, Output &output, size_t depth) const;
+
+    template <typename Output>
+    void writeAny(const std::any &value, Output &output, size_t depth) const;
+
+    template <typename Output>
+    void writeNewLine(Output &output, size_t depth) const;
+
+    int indent;
+};
\ No newline at end of file
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Векторная классификация входа блоками по 64 байта (первая стадия разбора).
+// Реализация (AVX2, SSE4.2 или скалярная) выбирается один раз во время выполнения
+namespace JsonSimd
+{
+
+constexpr size_t BLOCK_SIZE = 64;
+
+// Битовые маски блока: бит i соответствует байту i
+struct BlockMasks
+{
+    uint64_t space;             // ' ', '\t', '\r', '\n'
+    uint64_t structural;        // ',', ':', '[', ']', '{', '}'
+    uint64_t quote;             // '"'
+    uint64_t singleQuote;       // '\''
+    uint64_t backslash;         // '\\'
+};
+
+enum class Implementation
+{
+    Scalar,
+    Sse42,
+    Avx2,
+};
+
+// Лучшая реализация, поддерживаемая процессором
+Implementation bestImplementation();
+
+bool isSupported(Implementation implementation);
+
+// Классификация ровно BLOCK_SIZE байт лучшей реализацией
+BlockMasks classify(const char *block);
+
+// Классификация заданной реализацией (нужна для проверки реализаций между собой)
+BlockMasks classify(const char *block, Implementation implementation);
+
+}
\ No newline at end of file
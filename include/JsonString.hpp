@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+// Декодирование содержимого строк JSON (между кавычками)
+namespace JsonString
+{
+
+// Декодирует [begin, end) в output за один проход. Участки без экранирования копируются целиком,
+// поддерживаются все последовательности JSON, включая \uXXXX и суррогатные пары (результат в UTF-8),
+// а также \' для строк в одинарных кавычках.
+// Результат никогда не длиннее входа, поэтому в output должно быть не меньше (end - begin) байт.
+// Возвращает количество записанных байт. При ошибке генерируется JsonParseInvalidEscape
+size_t decode(const char *begin, const char *end, char *output);
+
+// То же с записью в строку: размер строки выставляется один раз заранее
+void decode(const char *begin, const char *end, std::string &output);
+
+}
\ No newline at end of file
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// Индекс структурных позиций входа, строится по маскам JsonSimd.
+// В индекс попадают: структурные символы вне строк, открывающие и закрывающие кавычки,
+// начала остальных лексем (чисел и ключевых слов). Содержимое строк в индекс не попадает.
+// Индекс строится окнами по мере продвижения, поэтому память не зависит от размера входа
+class JsonStructuralIndex
+{
+public:
+    JsonStructuralIndex(const char *inputBegin, const char *inputEnd);
+
+    // Первая проиндексированная позиция, не меньшая position, или конец входа.
+    // Позиции запрашиваются в неубывающем порядке
+    const char *next(const char *position)
+    {
+        while (true) {
+            for (; cursor < positions.size(); cursor++) {
+                if (positions[cursor] >= position) {
+                    return positions[cursor];
+                }
+            }
+            if (scanned == end) {
+                return end;
+            }
+            scanWindow();
+        }
+    }
+
+private:
+    void scanWindow();
+
+    void scanBlock(const char *block, const char *base);
+
+    const char *scanned;                    // Начало еще не проиндексированной части
+    const char *end;
+
+    std::vector<const char *> positions;    // Позиции текущего окна
+    size_t cursor = 0;
+
+    // Состояние, переносимое между блоками
+    bool inString = false;
+    char quoteChar = '\0';
+    bool escapeCarry = false;               // Последний байт блока - неэкранированный '\\'
+    bool separatorCarry = true;             // Последний байт блока - пробел или структурный символ
+};
\ No newline at end of file
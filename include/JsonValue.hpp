@@ -0,0 +1,272 @@
+#pragma once
+
+#include <any>
+#include <cstdint>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "JsonException.hpp"
+
+class Json;
+class JsonObject;
+struct JsonMember;
+
+// Значение JSON: компактное (16 байт) размеченное объединение null, bool, целого, double,
+// строки, массива или объекта. Тип проверяется по метке, без RTTI.
+// Значение само владеет строкой и вложенными контейнерами: копирование глубокое,
+// перемещение O(1). Значения внутри JsonDocument принадлежат арене документа и ничего не освобождают
+class JsonValue
+{
+public:
+    enum class Type : uint8_t
+    {
+        Null,
+        Bool,
+        Integer,                // int64_t
+        UnsignedInteger,        // uint64_t больше INT64_MAX
+        Double,
+        String,
+        Array,
+        Object,
+    };
+
+    // Контейнеры используют memory_resource: обычные значения - кучу, значения документа - арену
+    using ArrayType = std::pmr::vector<JsonValue>;
+    using ObjectType = JsonObject;                          // Пары в порядке вставки
+
+    JsonValue() = default;
+
+    JsonValue(std::nullptr_t)
+    {}
+
+    JsonValue(bool value)
+        : boolean(value), type(Type::Bool)
+    {}
+
+    JsonValue(int value)
+        : JsonValue(static_cast<int64_t>(value))
+    {}
+
+    JsonValue(int64_t value)
+        : integer(value), type(Type::Integer)
+    {}
+
+    JsonValue(uint64_t value);
+
+    JsonValue(double value)
+        : real(value), type(Type::Double)
+    {}
+
+    JsonValue(std::string_view value);
+
+    JsonValue(const char *value)
+        : JsonValue(std::string_view(value))
+    {}
+
+    JsonValue(const std::string &value)
+        : JsonValue(std::string_view(value))
+    {}
+
+    // Пустой массив
+    static JsonValue array();
+
+    // Пустой объект
+    static JsonValue object();
+
+    // Совместимость: преобразование дерева Json
+    explicit JsonValue(const Json &json);
+
+    JsonValue(const JsonValue &value);
+
+    JsonValue(JsonValue &&value) noexcept
+        : unsignedInteger(value.unsignedInteger), size(value.size), type(value.type), flags(value.flags)
+    {
+        value.type = Type::Null;
+        value.flags = 0;
+    }
+
+    JsonValue &operator=(const JsonValue &value);
+
+    JsonValue &operator=(JsonValue &&value) noexcept;
+
+    ~JsonValue()
+    {
+        if (flags & OWNED) {
+            destroy();
+        }
+    }
+
+    [[nodiscard]] Type getType() const
+    {
+        return type;
+    }
+
+    [[nodiscard]] bool is_null() const
+    {
+        return type == Type::Null;
+    }
+
+    [[nodiscard]] bool is_bool() const
+    {
+        return type == Type::Bool;
+    }
+
+    [[nodiscard]] bool is_number() const
+    {
+        return type == Type::Integer || type == Type::UnsignedInteger || type == Type::Double;
+    }
+
+    [[nodiscard]] bool is_string() const
+    {
+        return type == Type::String;
+    }
+
+    [[nodiscard]] bool is_array() const
+    {
+        return type == Type::Array;
+    }
+
+    [[nodiscard]] bool is_object() const
+    {
+        return type == Type::Object;
+    }
+
+    [[nodiscard]] bool asBool() const;
+
+    // Любое число, приведенное к double
+    [[nodiscard]] double asNumber() const;
+
+    // Целое значение. double допускается, если он без дробной части и помещается в результат
+    [[nodiscard]] int64_t asInteger() const;
+
+    [[nodiscard]] uint64_t asUnsignedInteger() const;
+
+    [[nodiscard]] std::string_view asString() const;
+
+    // Совместимость с std::any_cast: value.get<double>(), value.get<std::string>() и т.п.
+    // При несовпадении типа генерируется JsonUnexpectedType
+    template <typename T>
+    [[nodiscard]] T get() const
+    {
+        if constexpr (std::is_same_v<T, bool>) {
+            return asBool();
+        } else if constexpr (std::is_floating_point_v<T>) {
+            return static_cast<T>(asNumber());
+        } else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+            return static_cast<T>(asInteger());
+        } else if constexpr (std::is_integral_v<T>) {
+            return static_cast<T>(asUnsignedInteger());
+        } else if constexpr (std::is_same_v<T, std::string_view>) {
+            return asString();
+        } else {
+            static_assert(std::is_same_v<T, std::string>, "Unsupported type");
+            return std::string(asString());
+        }
+    }
+
+    // Размер массива или объекта, для остальных типов 0
+    [[nodiscard]] size_t getSize() const;
+
+    [[nodiscard]] std::vector<std::string_view> getKeys() const;
+
+    // Содержимое массива или объекта. Если тип другой, генерируется JsonUnexpectedType
+    [[nodiscard]] const ArrayType &asArray() const;
+
+    [[nodiscard]] const ObjectType &asObject() const;
+
+    // Значение по ключу. Если значение не объект или ключа нет, генерируется исключение
+    JsonValue &operator[](std::string_view key);
+
+    const JsonValue &operator[](std::string_view key) const;
+
+    JsonValue &operator[](const char *key)
+    {
+        return (*this)[std::string_view(key)];
+    }
+
+    const JsonValue &operator[](const char *key) const
+    {
+        return (*this)[std::string_view(key)];
+    }
+
+    // Значение по индексу. Если значение не массив или индекс вне границ, генерируется исключение
+    JsonValue &operator[](size_t index);
+
+    const JsonValue &operator[](size_t index) const;
+
+    JsonValue &operator[](int index)
+    {
+        return (*this)[static_cast<size_t>(index)];
+    }
+
+    const JsonValue &operator[](int index) const
+    {
+        return (*this)[static_cast<size_t>(index)];
+    }
+
+    // Зарезервировать место под size значений массива или объекта
+    void reserve(size_t size);
+
+    // Добавить в объект ключ, значение. Существующий ключ перезаписывается
+    void addToObjectKey(std::string_view key, JsonValue value);
+
+    // Добавить значение в массив
+    void addToArray(JsonValue value);
+
+    // Совместимость с деревом Json: значение в виде std::any (Json *, std::string, double, bool
+    // или пустое). Для массива и объекта создается новый Json *, владение передается вызывающему
+    [[nodiscard]] std::any toAny() const;
+
+    static JsonValue fromAny(const std::any &any);
+
+    [[nodiscard]] Json toJson() const;
+
+    static JsonValue parse(const std::string &string);
+
+    static JsonValue parse(const char *begin, const char *end);
+
+private:
+    friend class JsonLazyValue;
+    friend class JsonObject;
+    friend class JsonValueBuilder;
+
+    static constexpr uint8_t OWNED = 1;     // Значение освобождает строку или контейнер
+    static constexpr uint8_t INTERNED = 2;  // Строка - ключ из JsonKeyPool, перед ней лежит хеш
+
+    JsonValue(Type valueType, uint8_t valueFlags)
+        : type(valueType), flags(valueFlags)
+    {}
+
+    static uint32_t checkedSize(size_t size);
+
+    ArrayType &arrayData();
+
+    ObjectType &objectData();
+
+    void destroy();
+
+    union
+    {
+        bool boolean;
+        int64_t integer;
+        uint64_t unsignedInteger = 0;
+        double real;
+        const char *string;
+        ArrayType *arrayPointer;
+        ObjectType *objectPointer;
+    };
+    uint32_t size = 0;                      // Длина строки
+    Type type = Type::Null;
+    uint8_t flags = 0;
+};
+
+static_assert(sizeof(JsonValue) == 16, "JsonValue must stay compact");
+
+struct JsonMember
+{
+    JsonValue key;                          // Всегда строка
+    JsonValue value;
+};
\ No newline at end of file
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <string_view>
+#include <vector>
+
+#include "JsonArena.hpp"
+#include "JsonHandler.hpp"
+#include "JsonKeyPool.hpp"
+#include "JsonValue.hpp"
+
+// Обработчик, строящий JsonValue по событиям парсера. Значения открытых контейнеров копятся
+// на общем стеке и переносятся в контейнер точного размера при его закрытии.
+// Если задана арена, строки и контейнеры размещаются в ней и значения ничем не владеют.
+// Если вместе с ареной задан удерживаемый входной буфер, строки из него не копируются,
+// если задан пул ключей - ключи объектов берутся из пула
+class JsonValueBuilder final : public JsonHandler
+{
+public:
+    explicit JsonValueBuilder(JsonArena *valueArena = nullptr, std::string_view pinnedInput = {},
+                              JsonKeyPool *keyPool = nullptr)
+        : arena(valueArena), pinned(pinnedInput), keys(keyPool)
+    {}
+
+    void startObject() override;
+
+    void key(std::string_view key) override;
+
+    void endObject() override;
+
+    void startArray() override;
+
+    void endArray() override;
+
+    void string(std::string_view value) override;
+
+    void number(double value) override;
+
+    void integer(int64_t value) override;
+
+    void unsignedInteger(uint64_t value) override;
+
+    void boolean(bool value) override;
+
+    void null() override;
+
+    // Забрать построенный корень
+    JsonValue release();
+
+private:
+    JsonValue makeString(std::string_view value);
+
+    JsonValue makeKey(std::string_view key);
+
+    // Пустой массив или объект с местом под count значений
+    JsonValue makeContainer(JsonValue::Type type, size_t count);
+
+    JsonArena *arena;
+    std::string_view pinned;                // Буфер, переживающий построенные значения
+    JsonKeyPool *keys;
+    std::vector<JsonValue> values;
+    std::vector<size_t> frames;             // Начало значений каждого открытого контейнера
+};
\ No newline at end of file
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "JsonException.hpp"
+#include "JsonFormat.hpp"
+
+// Потоковая запись JSON без построения дерева: документ выводится по мере вызовов
+// beginObject, key, value, endArray и т.д. через буфер фиксированного размера в поток
+// или файловый дескриптор, поэтому память не зависит от размера документа.
+// В отладочной сборке (без NDEBUG) проверяется правильность вложенности: при ошибке
+// генерируется JsonWriteException. Формат такой же, как у Json::dump
+class JsonWriter
+{
+public:
+    static constexpr size_t BUFFER_SIZE = 1 << 16;
+
+    explicit JsonWriter(std::ostream &outputStream, int indentSize = -1);
+
+    // Дескриптор не закрывается. Ошибка записи - JsonWriteException
+    explicit JsonWriter(int outputDescriptor, int indentSize = -1);
+
+    JsonWriter(const JsonWriter &) = delete;
+
+    JsonWriter &operator=(const JsonWriter &) = delete;
+
+    // Сбрасывает буфер. Ошибки записи при этом игнорируются, чтобы их увидеть, нужно вызвать flush
+    ~JsonWriter();
+
+    JsonWriter &beginObject();
+
+    JsonWriter &endObject();
+
+    JsonWriter &beginArray();
+
+    JsonWriter &endArray();
+
+    JsonWriter &key(std::string_view key);
+
+    JsonWriter &value(std::string_view value);
+
+    JsonWriter &value(const char *value)
+    {
+        return this->value(std::string_view(value));
+    }
+
+    JsonWriter &value(const std::string &value)
+    {
+        return this->value(std::string_view(value));
+    }
+
+    JsonWriter &value(double value);
+
+    JsonWriter &value(int value)
+    {
+        return this->value(static_cast<int64_t>(value));
+    }
+
+    JsonWriter &value(int64_t value);
+
+    JsonWriter &value(uint64_t value);
+
+    JsonWriter &value(bool value);
+
+    JsonWriter &value(std::nullptr_t);
+
+    // Записать содержимое буфера
+    void flush();
+
+private:
+    struct Frame
+    {
+        bool object;
+        bool empty;
+    };
+
+    // Запятая и перенос строки перед значением
+    void beginValue();
+
+    void endContainer(bool object);
+
+    void writeNewLine(size_t depth);
+
+    void put(char c)
+    {
+        reserve(1);
+        buffer[size++] = c;
+    }
+
+    void write(std::string_view data);
+
+    void writeQuoted(std::string_view string);
+
+    template <typename T>
+    void writeNumber(T value)
+    {
+        reserve(JsonFormat::MAX_NUMBER_SIZE);
+        size = static_cast<size_t>(JsonFormat::writeNumber(buffer.get() + size, value) - buffer.get());
+    }
+
+    // Записать данные в поток или дескриптор, минуя буфер
+    void writeOut(const char *data, size_t count);
+
+    // Освободить в буфере место под count байт
+    void reserve(size_t count)
+    {
+        if (count > BUFFER_SIZE - size) {
+            flush();
+        }
+    }
+
+    std::ostream *stream = nullptr;
+    int descriptor = -1;
+    int indent;
+
+    std::unique_ptr<char[]> buffer;
+    size_t size = 0;
+
+    std::vector<Frame> frames;              // Открытые контейнеры
+    bool afterKey = false;                  // Записан ключ, ожидается его значение
+    bool rootWritten = false;
+};
\ No newline at end of file
@@ -16,8 +16,6 @@ bool isCharEscaping(char c);
 
 bool isCharSugar(char c);
 
-double stringToNumber(const std::string &string);
-
 template <typename T>
 bool isAnyEqual(const std::any &any, T value) {
     if (any.type() != typeid(T)) {
@@ -28,4 +26,4 @@ bool isAnyEqual(const std::any &any, T value) {
 }
 
 
-}
+}
\ No newline at end of file
@@ -1,63 +1,120 @@
-#include <stack>
-#include <fstream>
+#include <atomic>
+#include <memory>
+#include <type_traits>
 
 #include "Json.hpp"
+#include "JsonFile.hpp"
+#include "JsonLines.hpp"
 #include "JsonParser.hpp"
+#include "JsonSerializer.hpp"
 
-Json &Json::operator=(const Json &json)
+namespace
 {
-    if (this == &json) {
-        return *this;
-    }
-
-    this->~Json();
-
-    if (json.objectData) {
-        objectData = new ObjectType;
-
-        // Копирование
-        for (const auto &pair: *json.objectData) {
-            if (pair.second.type() == typeid(Json *)) {
-                auto &oldJson = *std::any_cast<Json *>(pair.second);
-
-                static_cast<ObjectType &>(*objectData)[pair.first] = new Json(oldJson);
+    // Удаление контейнера вместе с принадлежащими ему вложенными Json
+    template<typename Container>
+    void destroyContainer(Container *container)
+    {
+        for (const auto &element: *container) {
+            const std::any *value;
+            if constexpr (std::is_same_v<Container, Json::ObjectType>) {
+                value = &element.second;
             } else {
-                (*objectData)[pair.first] = pair.second;
+                value = &element;
+            }
+            if (value->type() == typeid(Json *)) {
+                delete std::any_cast<Json *>(*value);
             }
         }
+        delete container;
     }
-    if (json.arrayData) {
-        arrayData = new ArrayType;
-        arrayData->reserve(json.arrayData->size());
 
-        // Копирование
-        for (const std::any &value: *json.arrayData) {
-            if (value.type() == typeid(Json *)) {
-                auto &oldJson = *std::any_cast<Json *>(value);
-                arrayData->emplace_back(new Json(oldJson));
-            } else {
-                arrayData->push_back(value);
-            }
+    // Вложенный Json заменяется копией, разделяющей с ним данные
+    std::any share(const std::any &value)
+    {
+        if (value.type() == typeid(Json *)) {
+            return new Json(*std::any_cast<Json *>(value));
         }
+        return value;
     }
+}
 
-    return *this;
+Json::Json(const ObjectType &object)
+    : objectData(makeObject(ObjectType(object)))
+{}
+
+Json::Json(ObjectType &&object)
+    : objectData(makeObject(std::move(object)))
+{}
+
+Json::Json(const ArrayType &object)
+    : arrayData(makeArray(ArrayType(object)))
+{}
+
+Json::Json(ArrayType &&array)
+    : arrayData(makeArray(std::move(array)))
+{}
+
+Json::Json(const Json &json)
+    : objectData(json.objectData), arrayData(json.arrayData)
+{
+    if (json.exposed) {
+        detach();
+    }
 }
 
-Json &Json::operator=(Json &&json) noexcept
+Json &Json::operator=(const Json &json)
 {
-    if (this == &json) {
-        return *this;
+    if (this != &json) {
+        *this = Json(json);
     }
+    return *this;
+}
+
+std::shared_ptr<Json::ObjectType> Json::makeObject(ObjectType &&object)
+{
+    return {new ObjectType(std::move(object)), destroyContainer<ObjectType>};
+}
 
-    this->~Json();
+std::shared_ptr<Json::ArrayType> Json::makeArray(ArrayType &&array)
+{
+    return {new ArrayType(std::move(array)), destroyContainer<ArrayType>};
+}
 
-    objectData = json.objectData;
-    arrayData = json.arrayData;
-    json.objectData = nullptr;
-    json.arrayData = nullptr;
+void Json::detach()
+{
+    // use_count == 1 означает, что остальные владельцы уже освободили контейнер;
+    // барьер упорядочивает их чтение контейнера до последующей записи в него
+    // Копия заполняется поэлементно, чтобы при исключении удалить только созданные Json
+    if (objectData && objectData.use_count() > 1) {
+        std::shared_ptr<ObjectType> object = makeObject({});
+        object->reserve(objectData->size());
+        for (const auto &pair: *objectData) {
+            object->emplace(pair.first, share(pair.second));
+        }
+        objectData = std::move(object);
+    } else if (arrayData && arrayData.use_count() > 1) {
+        std::shared_ptr<ArrayType> array = makeArray({});
+        array->reserve(arrayData->size());
+        for (const std::any &value: *arrayData) {
+            array->push_back(share(value));
+        }
+        arrayData = std::move(array);
+    } else {
+        std::atomic_thread_fence(std::memory_order_acquire);
+    }
+}
 
-    return *this;
+void Json::expose()
+{
+    detach();
+    exposed = true;
+}
+
+void Json::exposeAdded(const std::any &value)
+{
+    if (value.type() == typeid(Json *)) {
+        exposed = true;
+    }
 }
 
 void Json::addToObjectKey(const std::string &key, const std::any &value)
@@ -66,18 +123,57 @@ void Json::addToObjectKey(const std::string &key, const std::any &value)
         throw JsonUnexpectedType("Expected JSON object");
     }
 
+    detach();
+    exposeAdded(value);
     (*objectData)[key] = value;
 }
 
+void Json::addToObjectKey(std::string &&key, std::any &&value)
+{
+    if (!objectData) {
+        throw JsonUnexpectedType("Expected JSON object");
+    }
+
+    detach();
+    exposeAdded(value);
+    (*objectData)[std::move(key)] = std::move(value);
+}
+
 void Json::addToArray(const std::any &value)
 {
     if (!arrayData) {
         throw JsonUnexpectedType("Expected JSON array");
     }
 
+    detach();
+    exposeAdded(value);
     arrayData->push_back(value);
 }
 
+void Json::addToArray(std::any &&value)
+{
+    if (!arrayData) {
+        throw JsonUnexpectedType("Expected JSON array");
+    }
+
+    detach();
+    exposeAdded(value);
+    arrayData->push_back(std::move(value));
+}
+
+void Json::reserve(size_t size)
+{
+    if (objectData) {
+        detach();
+        objectData->reserve(size);
+    } else if (arrayData) {
+        detach();
+        arrayData->reserve(size);
+    } else {
+        throw JsonUnexpectedType("Expected JSON object or array");
+    }
+}
+
 std::vector<std::string> Json::getKeys() const
 {
     if (!objectData) {
@@ -111,45 +207,41 @@ bool Json::is_object() const
     return objectData != nullptr;
 }
 
-Json::Json(const std::string &string)
+Json::Json(const std::string &string, bool preciseIntegers)
 {
-    std::unique_ptr<Json> result{JsonParser::parse(string)};
+    std::unique_ptr<Json> result{JsonParser::parse(string, preciseIntegers)};
     *this = std::move(*result);
 }
 
-Json::~Json()
+std::any &Json::operator[](const std::string &key)
 {
-    if (objectData) {
-        for (const auto &pair: *objectData) {
-            if (pair.second.type() == typeid(Json *)) {
-                delete std::any_cast<Json *>(pair.second);
-            }
-        }
+    if (!objectData) {
+        throw JsonUnexpectedType("Expected JSON object");
     }
 
-    if (arrayData) {
-        for (const std::any &value: *arrayData) {
-            if (value.type() == typeid(Json *)) {
-                delete std::any_cast<Json *>(value);
-            }
-        }
+    // Через ссылку вложенный Json может быть изменен, поэтому данные клонируются заранее
+    expose();
+    auto found = objectData->find(key);
+    if (found == objectData->end()) {
+        throw JsonUnexpectedKey("Expected JSON object key: " + key);
     }
 
-    delete objectData;
-    delete arrayData;
+    return found->second;
 }
 
-std::any &Json::operator[](const std::string &key)
+const std::any &Json::operator[](const std::string &key) const
 {
     if (!objectData) {
         throw JsonUnexpectedType("Expected JSON object");
     }
 
-    if (objectData->find(key) == objectData->cend()) {
+    // Только чтение: разделяемый контейнер не клонируется
+    auto found = objectData->find(key);
+    if (found == objectData->end()) {
         throw JsonUnexpectedKey("Expected JSON object key: " + key);
     }
 
-    return (*objectData)[key];
+    return found->second;
 }
 
 std::any &Json::operator[](int index)
@@ -162,6 +254,20 @@ std::any &Json::operator[](int index)
         throw JsonUnexpectedKey("Expected JSON array index: " + std::to_string(index));
     }
 
+    expose();
+    return (*arrayData)[index];
+}
+
+const std::any &Json::operator[](int index) const
+{
+    if (!arrayData) {
+        throw JsonUnexpectedType("Expected JSON array");
+    }
+
+    if (arrayData->size() <= static_cast<size_t>(index)) {
+        throw JsonUnexpectedKey("Expected JSON array index: " + std::to_string(index));
+    }
+
     return (*arrayData)[index];
 }
 
@@ -176,17 +282,33 @@ size_t Json::getSize() const
     return 0;
 }
 
-Json Json::parseFile(const std::string &pathToFile)
+Json Json::parseFile(const std::string &pathToFile, bool preciseIntegers)
 {
-    std::ifstream fileStream(pathToFile);
-    if (fileStream.fail()) {
-        throw JsonParseFileException("Cannot read file: " + pathToFile);
-    }
+    // Разбор идет прямо по отображенному в память файлу, без копирования в строку
+    JsonFile file(pathToFile);
+    std::unique_ptr<Json> result{JsonParser::parse(file.begin(), file.end(), preciseIntegers)};
+    return std::move(*result);
+}
 
-    std::string fullFile(
-        std::istreambuf_iterator<char>{fileStream},
-        std::istreambuf_iterator<char>()
-    );
+std::string Json::dump(int indent) const
+{
+    return JsonSerializer{indent}.dump(*this);
+}
 
-    return Json(fullFile);
+void Json::write(std::ostream &stream, int indent) const
+{
+    JsonSerializer{indent}.write(*this, stream);
 }
+
+std::vector<Json> Json::parseLines(const std::string &string, unsigned threads)
+{
+    return JsonLines::parse(string, threads);
+}
+
+Json Json::parseParallel(const std::string &string, unsigned threads, bool preciseIntegers)
+{
+    std::unique_ptr<Json> result{
+        JsonParser::parseParallel(string.data(), string.data() + string.size(), threads, preciseIntegers)
+    };
+    return std::move(*result);
+}
\ No newline at end of file
@@ -0,0 +1,63 @@
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include "JsonArena.hpp"
+
+namespace
+{
+
+// Блоки растут вдвое, но не больше этого размера
+constexpr size_t MAX_CHUNK_SIZE = 4 * 1024 * 1024;
+
+}
+
+std::string_view JsonArena::copy(std::string_view string)
+{
+    if (string.empty()) {
+        return {};
+    }
+
+    auto data = static_cast<char *>(allocate(string.size(), 1));
+    std::memcpy(data, string.data(), string.size());
+    return std::string_view(data, string.size());
+}
+
+void JsonArena::release()
+{
+    while (chunks) {
+        Chunk *previous = chunks->previous;
+        std::free(chunks);
+        chunks = previous;
+    }
+    current = nullptr;
+    limit = nullptr;
+    reservedSize = 0;
+}
+
+void *JsonArena::allocateSlow(size_t size, size_t alignment)
+{
+    size_t required = sizeof(Chunk) + size + alignment;
+
+    // Большой запрос получает отдельный блок, текущий блок продолжает использоваться
+    bool dedicated = required > nextChunkSize / 2;
+    size_t chunkSize = dedicated ? required : nextChunkSize;
+
+    auto chunk = static_cast<Chunk *>(std::malloc(chunkSize));
+    if (!chunk) {
+        throw std::bad_alloc{};
+    }
+    chunk->previous = chunks;
+    chunks = chunk;
+    reservedSize += chunkSize;
+
+    auto begin = reinterpret_cast<uintptr_t>(chunk + 1);
+    auto aligned = (begin + alignment - 1) & ~(alignment - 1);
+    if (dedicated) {
+        return reinterpret_cast<void *>(aligned);
+    }
+
+    nextChunkSize = std::min(nextChunkSize * 2, MAX_CHUNK_SIZE);
+    current = reinterpret_cast<char *>(aligned + size);
+    limit = reinterpret_cast<char *>(chunk) + chunkSize;
+    return reinterpret_cast<void *>(aligned);
+}
\ No newline at end of file
@@ -0,0 +1,247 @@
+#include "JsonBind.hpp"
+#include "JsonFile.hpp"
+#include "JsonReader.hpp"
+
+namespace
+{
+    constexpr size_t NO_FIELD = static_cast<size_t>(-1);
+
+    // Обработчик событий парсера, записывающий значения прямо в привязанные объекты
+    class JsonBindHandler
+    {
+    public:
+        JsonBindHandler(void *root, const JsonBindType &rootType)
+            : pending{root, &rootType}
+        {}
+
+        void startObject()
+        {
+            if (skipDepth > 0) {
+                skipDepth++;
+                return;
+            }
+            Target target = resolve(next(), false);
+            if (!target.object) {
+                skipDepth = 1;
+                return;
+            }
+            if (target.type->kind != JsonBindType::Kind::Struct) {
+                fail("Expected " + std::string(target.type->name) + ", got object");
+            }
+            stack.push_back(Frame{target.object, target.type, 0, NO_FIELD, 0});
+        }
+
+        void key(std::string_view key)
+        {
+            if (skipDepth > 0) {
+                return;
+            }
+
+            Frame &top = stack.back();
+            size_t i = top.type->findField(key);
+            if (i == NO_FIELD) {
+                top.field = NO_FIELD;
+                pending = Target{};
+                return;
+            }
+            if (top.seen & (uint64_t{1} << i)) {
+                throw JsonParseDuplicatedKeyError{"Duplicated key '" + std::string(key) + "'"};
+            }
+            top.seen |= uint64_t{1} << i;
+            top.field = i;
+            const JsonBindField &field = top.type->fields[i];
+            pending = Target{field.access(top.object), &field.type()};
+        }
+
+        void endObject()
+        {
+            if (skipDepth > 0) {
+                skipDepth--;
+                return;
+            }
+
+            const Frame &top = stack.back();
+            for (size_t i = 0; i < top.type->fieldCount; i++) {
+                if (top.type->fields[i].required && !(top.seen & (uint64_t{1} << i))) {
+                    fail("Missing field '" + std::string(top.type->fields[i].name) + "'", stack.size() - 1);
+                }
+            }
+            stack.pop_back();
+        }
+
+        void startArray()
+        {
+            if (skipDepth > 0) {
+                skipDepth++;
+                return;
+            }
+            Target target = resolve(next(), false);
+            if (!target.object) {
+                skipDepth = 1;
+                return;
+            }
+            if (target.type->kind != JsonBindType::Kind::Vector) {
+                fail("Expected " + std::string(target.type->name) + ", got array");
+            }
+            target.type->clear(target.object);
+            stack.push_back(Frame{target.object, target.type, 0, NO_FIELD, 0});
+        }
+
+        void endArray()
+        {
+            if (skipDepth > 0) {
+                skipDepth--;
+                return;
+            }
+            stack.pop_back();
+        }
+
+        void string(std::string_view value)
+        {
+            JsonBindScalar scalar;
+            scalar.kind = JsonBindScalar::Kind::String;
+            scalar.string = value;
+            assign(scalar, "string");
+        }
+
+        void number(double value)
+        {
+            JsonBindScalar scalar;
+            scalar.kind = JsonBindScalar::Kind::Double;
+            scalar.real = value;
+            assign(scalar, "number");
+        }
+
+        void integer(int64_t value)
+        {
+            JsonBindScalar scalar;
+            scalar.kind = JsonBindScalar::Kind::Integer;
+            scalar.integer = value;
+            assign(scalar, "number");
+        }
+
+        void unsignedInteger(uint64_t value)
+        {
+            JsonBindScalar scalar;
+            scalar.kind = JsonBindScalar::Kind::UnsignedInteger;
+            scalar.unsignedInteger = value;
+            assign(scalar, "number");
+        }
+
+        void boolean(bool value)
+        {
+            JsonBindScalar scalar;
+            scalar.kind = JsonBindScalar::Kind::Bool;
+            scalar.boolean = value;
+            assign(scalar, "boolean");
+        }
+
+        void null()
+        {
+            if (skipDepth > 0) {
+                return;
+            }
+            Target target = next();
+            if (target.object && target.type->kind != JsonBindType::Kind::Optional) {
+                fail("Expected " + std::string(target.type->name) + ", got null");
+            }
+            resolve(target, true);
+        }
+
+        // Значение неизвестного ключа не нужно: JsonReader пропускает его без событий
+        bool isValueSkipped() const
+        {
+            return skipDepth == 0 && !pending.object && !stack.empty()
+                && stack.back().type->kind == JsonBindType::Kind::Struct;
+        }
+
+    private:
+        struct Target
+        {
+            void *object = nullptr;                     // nullptr - значение пропускается
+            const JsonBindType *type = nullptr;
+        };
+
+        struct Frame
+        {
+            void *object;
+            const JsonBindType *type;
+            uint64_t seen;                              // Встреченные поля структуры
+            size_t field;                               // Текущее поле структуры
+            size_t index;                               // Число элементов массива
+        };
+
+        // Место для очередного значения: поле последнего ключа или новый элемент массива
+        Target next()
+        {
+            if (stack.empty() || stack.back().type->kind == JsonBindType::Kind::Struct) {
+                return std::exchange(pending, Target{});
+            }
+
+            Frame &top = stack.back();
+            top.index++;
+            return Target{top.type->add(top.object), &top.type->element()};
+        }
+
+        // Для std::optional: null сбрасывает значение, иначе значение создается
+        static Target resolve(Target target, bool isNull)
+        {
+            while (target.object && target.type->kind == JsonBindType::Kind::Optional) {
+                if (isNull) {
+                    target.type->clear(target.object);
+                    return Target{};
+                }
+                target = Target{target.type->add(target.object), &target.type->element()};
+            }
+            return target;
+        }
+
+        void assign(const JsonBindScalar &scalar, const char *kind)
+        {
+            if (skipDepth > 0) {
+                return;
+            }
+            Target target = resolve(next(), false);
+            if (!target.object) {
+                return;
+            }
+            if (target.type->kind != JsonBindType::Kind::Scalar || !target.type->assign(target.object, scalar)) {
+                fail("Expected " + std::string(target.type->name) + ", got " + kind);
+            }
+        }
+
+        // Путь к текущему значению по первым depth уровням: "items[2].name"
+        [[noreturn]] void fail(const std::string &message, size_t depth = NO_FIELD) const
+        {
+            std::string path;
+            for (size_t i = 0; i < std::min(depth, stack.size()); i++) {
+                const Frame &frame = stack[i];
+                if (frame.type->kind == JsonBindType::Kind::Vector) {
+                    path += "[" + std::to_string(frame.index - 1) + "]";
+                } else if (frame.field != NO_FIELD) {
+                    if (!path.empty()) {
+                        path += '.';
+                    }
+                    path += frame.type->fields[frame.field].name;
+                }
+            }
+            throw JsonBindException(path.empty() ? message : message + " at '" + path + "'");
+        }
+
+        Target pending;                                 // Поле последнего ключа, вначале - корень
+        std::vector<Frame> stack;
+        size_t skipDepth = 0;                           // Глубина пропускаемого значения
+    };
+}
+
+void JsonBind::parse(void *object, const JsonBindType &type, const char *begin, const char *end)
+{
+    JsonBindHandler handler{object, type};
+    JsonReader<JsonBindHandler>{begin, end, handler}.parseRoot();
+}
+
+void JsonBind::parseFile(void *object, const JsonBindType &type, const std::string &pathToFile)
+{
+    JsonFile file(pathToFile);
+    parse(object, type, file.begin(), file.end());
+}
\ No newline at end of file
@@ -0,0 +1,217 @@
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+
+#include "JsonCbor.hpp"
+#include "JsonCborReader.hpp"
+#include "JsonDomBuilder.hpp"
+#include "JsonFile.hpp"
+#include "JsonObject.hpp"
+
+namespace
+{
+    using namespace JsonCborFormat;
+
+    void writeBigEndian(uint64_t value, size_t size, std::string &output)
+    {
+        char bytes[sizeof(uint64_t)];
+        for (size_t i = 0; i < size; i++) {
+            bytes[i] = static_cast<char>(value >> (8 * (size - 1 - i)));
+        }
+        output.append(bytes, size);
+    }
+
+    // Начальный байт и аргумент в кратчайшей форме
+    void writeHeader(Major major, uint64_t argument, std::string &output)
+    {
+        auto type = static_cast<uint8_t>(major << 5);
+        if (argument < 24) {
+            output.push_back(static_cast<char>(type | argument));
+        } else if (argument <= std::numeric_limits<uint8_t>::max()) {
+            output.push_back(static_cast<char>(type | 24));
+            writeBigEndian(argument, 1, output);
+        } else if (argument <= std::numeric_limits<uint16_t>::max()) {
+            output.push_back(static_cast<char>(type | 25));
+            writeBigEndian(argument, 2, output);
+        } else if (argument <= std::numeric_limits<uint32_t>::max()) {
+            output.push_back(static_cast<char>(type | 26));
+            writeBigEndian(argument, 4, output);
+        } else {
+            output.push_back(static_cast<char>(type | 27));
+            writeBigEndian(argument, 8, output);
+        }
+    }
+
+    void writeInteger(int64_t value, std::string &output)
+    {
+        if (value >= 0) {
+            writeHeader(UNSIGNED, static_cast<uint64_t>(value), output);
+        } else {
+            writeHeader(NEGATIVE, static_cast<uint64_t>(-1 - value), output);
+        }
+    }
+
+    void writeNumber(double value, std::string &output, bool exactNumbers)
+    {
+        // Целые значения короче в целочисленной форме; -0.0 так записать нельзя
+        bool integral = std::isfinite(value) && std::trunc(value) == value && !(value == 0 && std::signbit(value));
+        if (integral && !exactNumbers) {
+            if (value >= 0 && value < 18446744073709551616.0) {
+                writeHeader(UNSIGNED, static_cast<uint64_t>(value), output);
+                return;
+            }
+            if (value < 0 && value >= -9223372036854775808.0) {
+                writeInteger(static_cast<int64_t>(value), output);
+                return;
+            }
+        }
+
+        if (std::fabs(value) <= FLT_MAX && static_cast<double>(static_cast<float>(value)) == value) {
+            auto single = static_cast<float>(value);
+            uint32_t bits;
+            std::memcpy(&bits, &single, sizeof(bits));
+            output.push_back(FLOAT_BYTE);
+            writeBigEndian(bits, sizeof(bits), output);
+            return;
+        }
+
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        output.push_back(DOUBLE_BYTE);
+        writeBigEndian(bits, sizeof(bits), output);
+    }
+
+    void writeString(std::string_view string, std::string &output)
+    {
+        writeHeader(TEXT, string.size(), output);
+        output.append(string);
+    }
+
+    void writeValue(const JsonValue &value, std::string &output, bool exactNumbers)
+    {
+        switch (value.getType()) {
+            case JsonValue::Type::Null:
+                output.push_back(NULL_BYTE);
+                break;
+            case JsonValue::Type::Bool:
+                output.push_back(value.asBool() ? TRUE_BYTE : FALSE_BYTE);
+                break;
+            case JsonValue::Type::Integer:
+                writeInteger(value.asInteger(), output);
+                break;
+            case JsonValue::Type::UnsignedInteger:
+                writeHeader(UNSIGNED, value.asUnsignedInteger(), output);
+                break;
+            case JsonValue::Type::Double:
+                writeNumber(value.asNumber(), output, exactNumbers);
+                break;
+            case JsonValue::Type::String:
+                writeString(value.asString(), output);
+                break;
+            case JsonValue::Type::Array:
+                writeHeader(ARRAY, value.getSize(), output);
+                for (const JsonValue &element : value.asArray()) {
+                    writeValue(element, output, exactNumbers);
+                }
+                break;
+            case JsonValue::Type::Object:
+                writeHeader(MAP, value.getSize(), output);
+                for (const JsonMember &member : value.asObject()) {
+                    writeString(member.key.asString(), output);
+                    writeValue(member.value, output, exactNumbers);
+                }
+                break;
+        }
+    }
+}
+
+std::string JsonCbor::encode(const Json &json, bool exactNumbers)
+{
+    std::string output;
+    encode(json, output, exactNumbers);
+    return output;
+}
+
+void JsonCbor::encode(const Json &json, std::string &output, bool exactNumbers)
+{
+    encodeJson(json, output, exactNumbers);
+}
+
+std::string JsonCbor::encode(const JsonValue &value, bool exactNumbers)
+{
+    std::string output;
+    encode(value, output, exactNumbers);
+    return output;
+}
+
+void JsonCbor::encode(const JsonValue &value, std::string &output, bool exactNumbers)
+{
+    writeValue(value, output, exactNumbers);
+}
+
+Json JsonCbor::decode(std::string_view input, bool preciseIntegers)
+{
+    // Так записывается пустой Json
+    if (input.size() == 1 && input[0] == NULL_BYTE) {
+        return Json{};
+    }
+
+    JsonDomBuilder builder{preciseIntegers};
+    JsonCborReader<JsonDomBuilder>{input.data(), input.data() + input.size(), builder}.parseRoot();
+    std::unique_ptr<Json> result{builder.release()};
+    return std::move(*result);
+}
+
+void JsonCbor::decode(std::string_view input, JsonHandler &handler)
+{
+    JsonCborReader<JsonHandler>{input.data(), input.data() + input.size(), handler}.parseRoot();
+}
+
+Json JsonCbor::decodeFile(const std::string &pathToFile, bool preciseIntegers)
+{
+    JsonFile file(pathToFile);
+    return decode(file.view(), preciseIntegers);
+}
+
+void JsonCbor::encodeJson(const Json &json, std::string &output, bool exactNumbers)
+{
+    if (json.objectData) {
+        writeHeader(MAP, json.objectData->size(), output);
+        for (const auto &pair : *json.objectData) {
+            writeString(pair.first, output);
+            encodeAny(pair.second, output, exactNumbers);
+        }
+    } else if (json.arrayData) {
+        writeHeader(ARRAY, json.arrayData->size(), output);
+        for (const std::any &element : *json.arrayData) {
+            encodeAny(element, output, exactNumbers);
+        }
+    } else {
+        output.push_back(NULL_BYTE);
+    }
+}
+
+void JsonCbor::encodeAny(const std::any &value, std::string &output, bool exactNumbers)
+{
+    const std::type_info &type = value.type();
+    if (type == typeid(Json *)) {
+        encodeJson(*std::any_cast<Json *>(value), output, exactNumbers);
+    } else if (type == typeid(std::string)) {
+        writeString(*std::any_cast<std::string>(&value), output);
+    } else if (type == typeid(double)) {
+        writeNumber(*std::any_cast<double>(&value), output, exactNumbers);
+    } else if (type == typeid(bool)) {
+        output.push_back(*std::any_cast<bool>(&value) ? TRUE_BYTE : FALSE_BYTE);
+    } else if (type == typeid(int64_t)) {
+        writeInteger(*std::any_cast<int64_t>(&value), output);
+    } else if (type == typeid(uint64_t)) {
+        writeHeader(UNSIGNED, *std::any_cast<uint64_t>(&value), output);
+    } else if (!value.has_value()) {
+        output.push_back(NULL_BYTE);
+    } else {
+        throw JsonUnexpectedType("Cannot encode value of type " + std::string(type.name()));
+    }
+}
\ No newline at end of file
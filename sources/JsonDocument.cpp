@@ -0,0 +1,83 @@
+#include <utility>
+
+#include "JsonCborReader.hpp"
+#include "JsonDocument.hpp"
+#include "JsonFile.hpp"
+#include "JsonReader.hpp"
+#include "JsonValueBuilder.hpp"
+
+JsonDocument::JsonDocument(JsonDocument &&document) noexcept
+    : buffer(std::move(document.buffer)), input(std::exchange(document.input, {})), keys(std::move(document.keys)),
+      arena(std::move(document.arena)), rootValue(std::move(document.rootValue))
+{}
+
+JsonDocument &JsonDocument::operator=(JsonDocument &&document) noexcept
+{
+    // Корень ничем не владеет, поэтому порядок присваивания не важен
+    buffer = std::move(document.buffer);
+    input = std::exchange(document.input, {});
+    keys = std::move(document.keys);
+    arena = std::move(document.arena);
+    rootValue = std::move(document.rootValue);
+    return *this;
+}
+
+JsonDocument JsonDocument::parse(const std::string &string, std::shared_ptr<JsonKeyPool> keyPool)
+{
+    return parse(string.data(), string.data() + string.size(), std::move(keyPool));
+}
+
+JsonDocument JsonDocument::parse(const char *begin, const char *end, std::shared_ptr<JsonKeyPool> keyPool)
+{
+    JsonDocument document;
+    document.arena = std::make_unique<JsonArena>();
+    document.keys = keyPool;
+
+    JsonValueBuilder builder{document.arena.get(), {}, keyPool.get()};
+    JsonReader<JsonValueBuilder>{begin, end, builder}.parseRoot();
+    document.rootValue = builder.release();
+
+    return document;
+}
+
+JsonDocument JsonDocument::parseInPlace(std::string &&string, std::shared_ptr<JsonKeyPool> keyPool)
+{
+    // Строка переносится в кучу: у короткой строки данные лежат внутри объекта и при перемещении сменили бы адрес
+    return parseInPlace(std::make_shared<const std::string>(std::move(string)), std::move(keyPool));
+}
+
+JsonDocument JsonDocument::parseInPlace(std::shared_ptr<const std::string> string, std::shared_ptr<JsonKeyPool> keyPool)
+{
+    std::string_view view = *string;
+    return parsePinned<JsonReader>(std::move(string), view, std::move(keyPool));
+}
+
+JsonDocument JsonDocument::parseFile(const std::string &pathToFile, std::shared_ptr<JsonKeyPool> keyPool)
+{
+    auto file = std::make_shared<const JsonFile>(pathToFile);
+    std::string_view view = file->view();
+    return parsePinned<JsonReader>(std::move(file), view, std::move(keyPool));
+}
+
+template <template <typename> class Reader>
+JsonDocument JsonDocument::parsePinned(std::shared_ptr<const void> buffer, std::string_view input,
+                                       std::shared_ptr<JsonKeyPool> keyPool)
+{
+    JsonDocument document;
+    document.buffer = std::move(buffer);
+    document.input = input;
+    document.arena = std::make_unique<JsonArena>();
+    document.keys = keyPool;
+
+    JsonValueBuilder builder{document.arena.get(), input, keyPool.get()};
+    Reader<JsonValueBuilder>{input.data(), input.data() + input.size(), builder}.parseRoot();
+    document.rootValue = builder.release();
+
+    return document;
+}
+
+template JsonDocument JsonDocument::parsePinned<JsonReader>(std::shared_ptr<const void>, std::string_view,
+                                                            std::shared_ptr<JsonKeyPool>);
+
+template JsonDocument JsonDocument::parsePinned<JsonCborReader>(std::shared_ptr<const void>, std::string_view,
+                                                                std::shared_ptr<JsonKeyPool>);
\ No newline at end of file
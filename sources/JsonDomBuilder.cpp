@@ -0,0 +1,90 @@
+#include "JsonDomBuilder.hpp"
+
+void JsonDomBuilder::startObject()
+{
+    startContainer(new Json(Json::ObjectType{}));
+}
+
+void JsonDomBuilder::key(std::string_view key)
+{
+    auto[it, inserted] = stack.back()->objectData->try_emplace(std::string(key));
+    if (!inserted) {
+        throw JsonParseDuplicatedKeyError{"Duplicated key '" + it->first + "'"};
+    }
+    pendingSlot = &it->second;
+}
+
+void JsonDomBuilder::endObject()
+{
+    stack.pop_back();
+}
+
+void JsonDomBuilder::startArray()
+{
+    startContainer(new Json(Json::ArrayType{}));
+}
+
+void JsonDomBuilder::endArray()
+{
+    stack.pop_back();
+}
+
+void JsonDomBuilder::string(std::string_view value)
+{
+    addValue(std::string(value));
+}
+
+void JsonDomBuilder::number(double value)
+{
+    addValue(value);
+}
+
+void JsonDomBuilder::integer(int64_t value)
+{
+    if (preciseIntegers) {
+        addValue(value);
+    } else {
+        addValue(static_cast<double>(value));
+    }
+}
+
+void JsonDomBuilder::unsignedInteger(uint64_t value)
+{
+    if (preciseIntegers) {
+        addValue(value);
+    } else {
+        addValue(static_cast<double>(value));
+    }
+}
+
+void JsonDomBuilder::boolean(bool value)
+{
+    addValue(value);
+}
+
+void JsonDomBuilder::null()
+{
+    addValue(std::any{});
+}
+
+void JsonDomBuilder::addValue(std::any &&value)
+{
+    Json &top = *stack.back();
+    if (top.arrayData) {
+        top.arrayData->push_back(std::move(value));
+    } else {
+        *pendingSlot = std::move(value);
+    }
+}
+
+void JsonDomBuilder::startContainer(Json *json)
+{
+    std::unique_ptr<Json> holder{json};
+    if (stack.empty()) {
+        root = std::move(holder);
+    } else {
+        addValue(json);
+        holder.release();
+    }
+    stack.push_back(json);
+}
\ No newline at end of file
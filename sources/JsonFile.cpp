@@ -0,0 +1,123 @@
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <utility>
+
+#include "JsonException.hpp"
+#include "JsonFile.hpp"
+
+namespace
+{
+    // Закрывает дескриптор при выходе из конструктора, в том числе по исключению
+    struct Descriptor
+    {
+        int value;
+
+        ~Descriptor()
+        {
+            ::close(value);
+        }
+    };
+
+    constexpr size_t READ_CHUNK_SIZE = 1 << 16;
+
+    [[noreturn]] void throwFileError(const std::string &path)
+    {
+        int error = errno;
+        throw JsonParseFileException("Cannot read file: " + path + ": " + std::strerror(error));
+    }
+}
+
+JsonFile::JsonFile(const std::string &path)
+{
+    Descriptor descriptor{::open(path.c_str(), O_RDONLY | O_CLOEXEC)};
+    if (descriptor.value < 0) {
+        throwFileError(path);
+    }
+
+    struct stat status{};
+    if (::fstat(descriptor.value, &status) != 0) {
+        throwFileError(path);
+    }
+
+    // Пустой файл отобразить нельзя, а у каналов и устройств размер неизвестен
+    if (S_ISREG(status.st_mode) && status.st_size > 0) {
+        auto fileSize = static_cast<size_t>(status.st_size);
+        void *mapping = ::mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, descriptor.value, 0);
+        if (mapping != MAP_FAILED) {
+            ::madvise(mapping, fileSize, MADV_SEQUENTIAL);
+            data = static_cast<const char *>(mapping);
+            size = fileSize;
+            mapped = true;
+            return;
+        }
+    }
+
+    readAll(descriptor.value, S_ISREG(status.st_mode) ? static_cast<size_t>(status.st_size) : 0, path);
+}
+
+JsonFile::JsonFile(JsonFile &&file) noexcept
+{
+    *this = std::move(file);
+}
+
+JsonFile &JsonFile::operator=(JsonFile &&file) noexcept
+{
+    if (this == &file) {
+        return *this;
+    }
+
+    unmap();
+    mapped = std::exchange(file.mapped, false);
+    size = std::exchange(file.size, 0);
+    buffer = std::move(file.buffer);
+    data = mapped ? std::exchange(file.data, nullptr) : buffer.data();
+    file.data = nullptr;
+    return *this;
+}
+
+JsonFile::~JsonFile()
+{
+    unmap();
+}
+
+void JsonFile::readAll(int descriptor, size_t sizeHint, const std::string &path)
+{
+    // Для обычного файла буфер сразу нужного размера, для канала растет кусками
+    buffer.resize(sizeHint ? sizeHint : READ_CHUNK_SIZE);
+
+    size_t total = 0;
+    while (true) {
+        if (total == buffer.size()) {
+            buffer.resize(buffer.size() + (sizeHint ? READ_CHUNK_SIZE : buffer.size()));
+        }
+
+        ssize_t count = ::read(descriptor, buffer.data() + total, buffer.size() - total);
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throwFileError(path);
+        }
+        if (count == 0) {
+            break;
+        }
+        total += static_cast<size_t>(count);
+    }
+
+    buffer.resize(total);
+    data = buffer.data();
+    size = total;
+}
+
+void JsonFile::unmap()
+{
+    if (mapped) {
+        ::munmap(const_cast<char *>(data), size);
+        mapped = false;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,100 @@
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+
+#include "JsonFormat.hpp"
+
+namespace
+{
+
+// Для каждого байта: 0 - без экранирования, иначе символ после '\' ('u' - \u00XX)
+constexpr std::array<char, 256> makeEscapes()
+{
+    std::array<char, 256> escapes{};
+    for (size_t c = 0; c < 0x20; c++) {
+        escapes[c] = 'u';
+    }
+    escapes['"'] = '"';
+    escapes['\\'] = '\\';
+    escapes['\b'] = 'b';
+    escapes['\f'] = 'f';
+    escapes['\n'] = 'n';
+    escapes['\r'] = 'r';
+    escapes['\t'] = 't';
+    return escapes;
+}
+
+constexpr std::array<char, 256> escapes = makeEscapes();
+
+char escapeOf(char c)
+{
+    return escapes[static_cast<unsigned char>(c)];
+}
+
+}
+
+size_t JsonFormat::quotedSize(std::string_view string)
+{
+    size_t size = string.size() + 2;
+    for (char c : string) {
+        char escape = escapeOf(c);
+        if (escape) {
+            size += escape == 'u' ? 5 : 1;
+        }
+    }
+    return size;
+}
+
+char *JsonFormat::writeQuoted(char *out, std::string_view string)
+{
+    *out++ = '"';
+
+    const char *run = string.data();
+    const char *end = string.data() + string.size();
+    for (const char *current = run; current != end; current++) {
+        char escape = escapeOf(*current);
+        if (!escape) {
+            continue;
+        }
+
+        std::memcpy(out, run, static_cast<size_t>(current - run));
+        out += current - run;
+        run = current + 1;
+
+        *out++ = '\\';
+        *out++ = escape;
+        if (escape == 'u') {
+            constexpr char hex[] = "0123456789abcdef";
+            auto code = static_cast<unsigned char>(*current);
+            *out++ = '0';
+            *out++ = '0';
+            *out++ = hex[code >> 4];
+            *out++ = hex[code & 0xF];
+        }
+    }
+    std::memcpy(out, run, static_cast<size_t>(end - run));
+    out += end - run;
+
+    *out++ = '"';
+    return out;
+}
+
+char *JsonFormat::writeNumber(char *out, double value)
+{
+    if (!std::isfinite(value)) {
+        std::memcpy(out, "null", 4);
+        return out + 4;
+    }
+    return std::to_chars(out, out + MAX_NUMBER_SIZE, value).ptr;
+}
+
+char *JsonFormat::writeNumber(char *out, int64_t value)
+{
+    return std::to_chars(out, out + MAX_NUMBER_SIZE, value).ptr;
+}
+
+char *JsonFormat::writeNumber(char *out, uint64_t value)
+{
+    return std::to_chars(out, out + MAX_NUMBER_SIZE, value).ptr;
+}
\ No newline at end of file
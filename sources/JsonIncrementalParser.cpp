@@ -0,0 +1,287 @@
+#include <algorithm>
+
+#include "JsonException.hpp"
+#include "JsonIncrementalParser.hpp"
+#include "JsonNumber.hpp"
+#include "JsonString.hpp"
+#include "Utils.hpp"
+
+void JsonIncrementalParser::feed(const char *data, size_t size)
+{
+    const char *current = data;
+    const char *end = data + size;
+    while (current != end) {
+        switch (token) {
+            case Token::String:
+                current = continueString(current, end);
+                break;
+            case Token::Number:
+                current = continueNumber(current, end);
+                break;
+            case Token::Keyword:
+                current = continueKeyword(current, end);
+                break;
+            default:
+                current = parseStructure(current, end);
+                break;
+        }
+    }
+}
+
+void JsonIncrementalParser::finish()
+{
+    // Число заканчивается только следующим символом, поэтому в конце входа оно завершается здесь
+    if (token == Token::Number) {
+        finishNumber(pending);
+    } else if (token == Token::String) {
+        throw JsonParseUnexpectedEof{"Expected end of the string"};
+    } else if (token == Token::Keyword) {
+        throw JsonParseUnexpectedChar{"Unexpected char '" + std::string{keyword.front()} + "'"};
+    }
+
+    switch (state) {
+        case State::Done:
+            state = State::Start;
+            return;
+        case State::Start:
+            throw JsonParseUnexpectedEof{"Expected start of JSON"};
+        case State::Key:
+            throw JsonParseUnexpectedEof{"Expected key"};
+        case State::Colon:
+            throw JsonParseUnexpectedEof{"Expected ':'"};
+        case State::Value:
+            throw JsonParseUnexpectedEof{"Expected value"};
+        default:
+            throw JsonParseUnexpectedEof{containers.back() == '[' ? "Expected end of array" : "Expected end of object"};
+    }
+}
+
+const char *JsonIncrementalParser::parseStructure(const char *current, const char *end)
+{
+    current = std::find_if_not(current, end, Utils::isCharSpace);
+    if (current == end) {
+        return end;
+    }
+
+    char c = *current;
+    switch (state) {
+        case State::Start:
+            if (c != '[' && c != '{') {
+                throw JsonParseUnexpectedChar{"Expected start of JSON"};
+            }
+            return beginValue(current);
+
+        case State::Value:
+            return beginValue(current);
+
+        case State::ArrayFirst:
+            if (c == ']') {
+                closeContainer();
+                return current + 1;
+            }
+            return beginValue(current);
+
+        case State::ObjectFirst:
+            if (c == '}') {
+                closeContainer();
+                return current + 1;
+            }
+            [[fallthrough]];
+
+        case State::Key:
+            if (!Utils::isCharQuote(c)) {
+                throw JsonParseUnexpectedChar{"Expected key"};
+            }
+            token = Token::String;
+            quote = c;
+            stringIsKey = true;
+            return current + 1;
+
+        case State::Colon:
+            if (c != ':') {
+                throw JsonParseUnexpectedChar{"Expected ':'"};
+            }
+            state = State::Value;
+            return current + 1;
+
+        case State::AfterValue:
+            if (c == ',') {
+                state = containers.back() == '[' ? State::Value : State::Key;
+                return current + 1;
+            }
+            if (c != (containers.back() == '[' ? ']' : '}')) {
+                throw JsonParseUnexpectedChar{"Expected ','"};
+            }
+            closeContainer();
+            return current + 1;
+
+        default:
+            throw JsonParseUnexpectedChar{"Excepted end of JSON"};
+    }
+}
+
+const char *JsonIncrementalParser::beginValue(const char *current)
+{
+    char c = *current;
+    if (c == '[') {
+        handler.startArray();
+        containers.push_back(c);
+        state = State::ArrayFirst;
+        return current + 1;
+    }
+    if (c == '{') {
+        handler.startObject();
+        containers.push_back(c);
+        state = State::ObjectFirst;
+        return current + 1;
+    }
+    if (Utils::isCharQuote(c)) {
+        token = Token::String;
+        quote = c;
+        stringIsKey = false;
+        return current + 1;
+    }
+    if (Utils::isCharNumber(c)) {
+        token = Token::Number;
+        return current;
+    }
+
+    switch (c) {
+        case 't':
+            keyword = "true";
+            break;
+        case 'f':
+            keyword = "false";
+            break;
+        case 'n':
+            keyword = "null";
+            break;
+        default:
+            throw JsonParseUnexpectedChar{"Unexpected char '" + std::string{c} + "'"};
+    }
+    token = Token::Keyword;
+    keywordMatched = 0;
+    return current;
+}
+
+const char *JsonIncrementalParser::continueString(const char *current, const char *end)
+{
+    const char *position = current;
+    for (; position != end; position++) {
+        if (escaped) {
+            escaped = false;
+        } else if (*position == '\\') {
+            escaped = true;
+            hasEscapes = true;
+        } else if (*position == quote) {
+            break;
+        }
+    }
+
+    if (position == end) {
+        pending.append(current, end);
+        return end;
+    }
+
+    // Строка целиком в текущей части передается без копирования
+    if (pending.empty()) {
+        finishString(std::string_view(current, static_cast<size_t>(position - current)));
+    } else {
+        pending.append(current, position);
+        finishString(pending);
+    }
+    return position + 1;
+}
+
+const char *JsonIncrementalParser::continueNumber(const char *current, const char *end)
+{
+    const char *numberEnd = std::find_if_not(current, end, Utils::isCharNumber);
+    if (numberEnd == end) {
+        pending.append(current, end);
+        return end;
+    }
+
+    if (pending.empty()) {
+        finishNumber(std::string_view(current, static_cast<size_t>(numberEnd - current)));
+    } else {
+        pending.append(current, numberEnd);
+        finishNumber(pending);
+    }
+    return numberEnd;
+}
+
+const char *JsonIncrementalParser::continueKeyword(const char *current, const char *end)
+{
+    for (; current != end && keywordMatched < keyword.size(); current++, keywordMatched++) {
+        if (*current != keyword[keywordMatched]) {
+            throw JsonParseUnexpectedChar{"Unexpected char '" + std::string{keyword.front()} + "'"};
+        }
+    }
+
+    if (keywordMatched == keyword.size()) {
+        token = Token::None;
+        if (keyword.front() == 'n') {
+            handler.null();
+        } else {
+            handler.boolean(keyword.front() == 't');
+        }
+        valueDone();
+    }
+    return current;
+}
+
+void JsonIncrementalParser::finishString(std::string_view raw)
+{
+    std::string_view value = raw;
+    if (hasEscapes) {
+        JsonString::decode(raw.data(), raw.data() + raw.size(), decoded);
+        value = decoded;
+    }
+
+    token = Token::None;
+    hasEscapes = false;
+    if (stringIsKey) {
+        handler.key(value);
+        state = State::Colon;
+    } else {
+        handler.string(value);
+        valueDone();
+    }
+    pending.clear();
+}
+
+void JsonIncrementalParser::finishNumber(std::string_view text)
+{
+    JsonNumber number;
+    const char *numberEnd = JsonNumber::parse(text.data(), text.data() + text.size(), number);
+    if (numberEnd != text.data() + text.size()) {
+        throw JsonParseCannotParseNumber{"Cannot parse number '" + std::string(text) + "'"};
+    }
+
+    token = Token::None;
+    switch (number.type) {
+        case JsonNumber::Type::Integer:
+            handler.integer(number.integer);
+            break;
+        case JsonNumber::Type::UnsignedInteger:
+            handler.unsignedInteger(number.unsignedInteger);
+            break;
+        default:
+            handler.number(number.real);
+            break;
+    }
+    valueDone();
+    pending.clear();
+}
+
+void JsonIncrementalParser::closeContainer()
+{
+    char open = containers.back();
+    containers.pop_back();
+    if (open == '[') {
+        handler.endArray();
+    } else {
+        handler.endObject();
+    }
+    valueDone();
+}
\ No newline at end of file
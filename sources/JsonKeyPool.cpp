@@ -0,0 +1,56 @@
+#include <mutex>
+
+#include "JsonKeyPool.hpp"
+#include "JsonObject.hpp"
+
+std::string_view JsonKeyPool::intern(std::string_view key)
+{
+    if (!locking) {
+        auto found = keys.find(key);
+        return found != keys.end() ? *found : insert(key, JsonObject::hash(key));
+    }
+
+    // Обычно ключ уже есть в пуле, и потоки ищут его одновременно
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        auto found = keys.find(key);
+        if (found != keys.end()) {
+            return *found;
+        }
+    }
+
+    size_t hash = JsonObject::hash(key);
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    auto found = keys.find(key);
+    return found != keys.end() ? *found : insert(key, hash);
+}
+
+size_t JsonKeyPool::getSize() const
+{
+    std::shared_lock<std::shared_mutex> lock(mutex, std::defer_lock);
+    if (locking) {
+        lock.lock();
+    }
+    return keys.size();
+}
+
+size_t JsonKeyPool::getMemoryUsage() const
+{
+    std::shared_lock<std::shared_mutex> lock(mutex, std::defer_lock);
+    if (locking) {
+        lock.lock();
+    }
+    return arena.getReservedSize() + keys.bucket_count() * sizeof(void *) + keys.size() * (sizeof(std::string_view) + 2 * sizeof(void *));
+}
+
+std::string_view JsonKeyPool::insert(std::string_view key, size_t hash)
+{
+    // Хеш лежит перед символами ключа
+    auto data = static_cast<char *>(arena.allocate(sizeof(size_t) + key.size(), alignof(size_t)));
+    std::memcpy(data, &hash, sizeof(size_t));
+    std::memcpy(data + sizeof(size_t), key.data(), key.size());
+
+    std::string_view interned(data + sizeof(size_t), key.size());
+    keys.insert(interned);
+    return interned;
+}
\ No newline at end of file
@@ -0,0 +1,377 @@
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <unordered_map>
+
+#include "JsonFile.hpp"
+#include "JsonLazy.hpp"
+#include "JsonNumber.hpp"
+#include "JsonString.hpp"
+#include "JsonStructuralIndex.hpp"
+#include "Utils.hpp"
+
+namespace
+{
+    // Начиная с этого числа ключей поиск идет по хеш-таблице
+    constexpr size_t INDEX_THRESHOLD = 16;
+
+    // Лексема должна заканчиваться пробелом, структурным символом или концом входа
+    bool isTokenEnd(const char *position, const char *end)
+    {
+        return position == end || Utils::isCharSpace(*position) || Utils::isCharSugar(*position);
+    }
+}
+
+struct JsonLazyValue::Children
+{
+    std::unique_ptr<JsonLazyValue[]> values;
+    size_t size = 0;
+    std::vector<JsonValue> keys;            // Только у объекта
+    std::unordered_map<std::string_view, size_t> index;
+};
+
+JsonLazyValue::~JsonLazyValue()
+{
+    delete children.load(std::memory_order_relaxed);
+}
+
+const JsonValue &JsonLazyValue::asValue() const
+{
+    if (type == JsonValue::Type::Array || type == JsonValue::Type::Object) {
+        throw JsonUnexpectedType("Expected JSON scalar");
+    }
+    return scalar;
+}
+
+size_t JsonLazyValue::getSize() const
+{
+    if (type != JsonValue::Type::Array && type != JsonValue::Type::Object) {
+        return 0;
+    }
+    return expand().size;
+}
+
+std::vector<std::string_view> JsonLazyValue::getKeys() const
+{
+    if (type != JsonValue::Type::Object) {
+        throw JsonUnexpectedType("Expected JSON object");
+    }
+
+    const Children &object = expand();
+    std::vector<std::string_view> result;
+    result.reserve(object.size);
+    for (const JsonValue &key : object.keys) {
+        result.push_back(key.asString());
+    }
+    return result;
+}
+
+const JsonLazyValue &JsonLazyValue::operator[](std::string_view key) const
+{
+    if (type != JsonValue::Type::Object) {
+        throw JsonUnexpectedType("Expected JSON object");
+    }
+
+    const Children &object = expand();
+    if (object.index.empty()) {
+        for (size_t i = 0; i < object.size; i++) {
+            if (object.keys[i].asString() == key) {
+                return object.values[i];
+            }
+        }
+    } else {
+        auto found = object.index.find(key);
+        if (found != object.index.end()) {
+            return object.values[found->second];
+        }
+    }
+    throw JsonUnexpectedKey("Expected JSON object key: " + std::string(key));
+}
+
+const JsonLazyValue &JsonLazyValue::operator[](size_t index) const
+{
+    if (type != JsonValue::Type::Array) {
+        throw JsonUnexpectedType("Expected JSON array");
+    }
+
+    const Children &array = expand();
+    if (index >= array.size) {
+        throw JsonUnexpectedKey("Expected JSON array index: " + std::to_string(index));
+    }
+    return array.values[index];
+}
+
+JsonValue JsonLazyValue::toValue() const
+{
+    if (type == JsonValue::Type::Array) {
+        const Children &array = expand();
+        JsonValue result = JsonValue::array();
+        result.reserve(array.size);
+        for (size_t i = 0; i < array.size; i++) {
+            result.addToArray(array.values[i].toValue());
+        }
+        return result;
+    }
+    if (type == JsonValue::Type::Object) {
+        const Children &object = expand();
+        JsonValue result = JsonValue::object();
+        result.reserve(object.size);
+        for (size_t i = 0; i < object.size; i++) {
+            result.addToObjectKey(object.keys[i].asString(), object.values[i].toValue());
+        }
+        return result;
+    }
+    return scalar;
+}
+
+void JsonLazyValue::initialize(const JsonLazyTape *valueTape, uint32_t valuePosition)
+{
+    tape = valueTape;
+    position = valuePosition;
+
+    const char *current = tape->positions[position];
+    char c = *current;
+    if (c == '[' || c == '{') {
+        type = c == '[' ? JsonValue::Type::Array : JsonValue::Type::Object;
+        return;
+    }
+
+    if (Utils::isCharQuote(c)) {
+        // Следующая позиция разметки - закрывающая кавычка
+        const char *stringEnd = tape->positions[position + 1];
+        auto length = static_cast<size_t>(stringEnd - current - 1);
+        if (std::memchr(current + 1, '\\', length)) {
+            std::string decoded;
+            JsonString::decode(current + 1, stringEnd, decoded);
+            scalar = JsonValue(decoded);
+        } else {
+            // Строка указывает во входной буфер, который удерживает документ
+            scalar = JsonValue{JsonValue::Type::String, 0};
+            scalar.string = current + 1;
+            scalar.size = JsonValue::checkedSize(length);
+        }
+    } else if (Utils::isCharNumber(c)) {
+        JsonNumber number;
+        const char *numberEnd = JsonNumber::parse(current, tape->end, number);
+        if (!numberEnd || !isTokenEnd(numberEnd, tape->end)) {
+            const char *runEnd = std::find_if_not(current, tape->end, Utils::isCharNumber);
+            throw JsonParseCannotParseNumber{"Cannot parse number '" + std::string(current, runEnd) + "'"};
+        }
+        switch (number.type) {
+            case JsonNumber::Type::Integer:
+                scalar = JsonValue(number.integer);
+                break;
+            case JsonNumber::Type::UnsignedInteger:
+                scalar = JsonValue(number.unsignedInteger);
+                break;
+            default:
+                scalar = JsonValue(number.real);
+                break;
+        }
+    } else {
+        auto matches = [this, current](std::string_view keyword) {
+            auto length = static_cast<size_t>(tape->end - current);
+            return length >= keyword.size() && std::equal(keyword.cbegin(), keyword.cend(), current)
+                && isTokenEnd(current + keyword.size(), tape->end);
+        };
+        if (matches("true")) {
+            scalar = JsonValue(true);
+        } else if (matches("false")) {
+            scalar = JsonValue(false);
+        } else if (!matches("null")) {
+            throw JsonParseUnexpectedChar{"Unexpected char '" + std::string{c} + "'"};
+        }
+    }
+    type = scalar.getType();
+}
+
+const JsonLazyValue::Children &JsonLazyValue::expand() const
+{
+    Children *current = children.load(std::memory_order_acquire);
+    if (current) {
+        return *current;
+    }
+
+    // Несколько потоков могут разобрать контейнер одновременно, публикуется первый результат
+    std::unique_ptr<Children> built{buildChildren()};
+    Children *expected = nullptr;
+    if (children.compare_exchange_strong(expected, built.get(), std::memory_order_acq_rel, std::memory_order_acquire)) {
+        return *built.release();
+    }
+    return *expected;
+}
+
+JsonLazyValue::Children *JsonLazyValue::buildChildren() const
+{
+    const std::vector<const char *> &positions = tape->positions;
+    bool object = type == JsonValue::Type::Object;
+    uint32_t close = tape->closes[position];
+
+    auto expect = [&positions, close](uint32_t current, const char *message) {
+        if (current >= close) {
+            throw JsonParseUnexpectedChar{message};
+        }
+        return *positions[current];
+    };
+
+    auto result = std::make_unique<Children>();
+    std::vector<uint32_t> values;
+    uint32_t current = position + 1;
+    while (current != close) {
+        if (object) {
+            if (!Utils::isCharQuote(expect(current, "Expected key"))) {
+                throw JsonParseUnexpectedChar{"Expected key"};
+            }
+            JsonLazyValue key;
+            key.initialize(tape, current);
+            result->keys.push_back(std::move(key.scalar));
+            current += 2;
+
+            if (expect(current, "Expected ':'") != ':') {
+                throw JsonParseUnexpectedChar{"Expected ':'"};
+            }
+            current++;
+        }
+
+        // Вложенный контейнер пропускается до парной скобки
+        char c = expect(current, "Expected value");
+        values.push_back(current);
+        if (c == '[' || c == '{') {
+            current = tape->closes[current] + 1;
+        } else if (Utils::isCharQuote(c)) {
+            current += 2;
+        } else if (Utils::isCharSugar(c)) {
+            throw JsonParseUnexpectedChar{"Expected value"};
+        } else {
+            current++;
+        }
+
+        if (current == close) {
+            break;
+        }
+        if (*positions[current] != ',') {
+            throw JsonParseUnexpectedChar{"Expected ','"};
+        }
+        current++;
+        if (current == close) {
+            throw JsonParseUnexpectedChar{object ? "Expected key" : "Expected value"};
+        }
+    }
+
+    result->size = values.size();
+    result->values = std::make_unique<JsonLazyValue[]>(values.size());
+    for (size_t i = 0; i < values.size(); i++) {
+        result->values[i].initialize(tape, values[i]);
+    }
+
+    if (object) {
+        // Проверка дубликатов: для небольших объектов перебором, иначе по хеш-таблице
+        if (result->size < INDEX_THRESHOLD) {
+            for (size_t i = 0; i < result->size; i++) {
+                for (size_t j = 0; j < i; j++) {
+                    if (result->keys[i].asString() == result->keys[j].asString()) {
+                        throw JsonParseDuplicatedKeyError{"Duplicated key '" + std::string(result->keys[i].asString()) + "'"};
+                    }
+                }
+            }
+        } else {
+            result->index.reserve(result->size);
+            for (size_t i = 0; i < result->size; i++) {
+                if (!result->index.emplace(result->keys[i].asString(), i).second) {
+                    throw JsonParseDuplicatedKeyError{"Duplicated key '" + std::string(result->keys[i].asString()) + "'"};
+                }
+            }
+        }
+    }
+    return result.release();
+}
+
+JsonLazyDocument JsonLazyDocument::parse(std::string &&string)
+{
+    return parseInPlace(std::make_shared<const std::string>(std::move(string)));
+}
+
+JsonLazyDocument JsonLazyDocument::parseInPlace(std::shared_ptr<const std::string> string)
+{
+    std::string_view view = *string;
+    return parsePinned(std::move(string), view);
+}
+
+JsonLazyDocument JsonLazyDocument::parseFile(const std::string &pathToFile)
+{
+    auto file = std::make_shared<const JsonFile>(pathToFile);
+    std::string_view view = file->view();
+    return parsePinned(std::move(file), view);
+}
+
+JsonLazyDocument JsonLazyDocument::parsePinned(std::shared_ptr<const void> buffer, std::string_view input)
+{
+    const char *begin = input.data();
+    const char *end = input.data() + input.size();
+
+    auto tape = std::make_unique<JsonLazyTape>();
+    tape->buffer = std::move(buffer);
+    tape->end = end;
+
+    // Разметка строится одним проходом по структурному индексу, скобки сопоставляются стеком
+    JsonStructuralIndex index(begin, end);
+    std::vector<uint32_t> open;
+    for (const char *current = index.next(begin); current != end; current = index.next(current + 1)) {
+        if (tape->positions.size() >= std::numeric_limits<uint32_t>::max() - 1) {
+            throw JsonException("Document is too large for lazy parsing");
+        }
+        auto number = static_cast<uint32_t>(tape->positions.size());
+        tape->positions.push_back(current);
+        tape->closes.push_back(0);
+
+        char c = *current;
+        if (tape->positions.size() == 1 && c != '[' && c != '{') {
+            throw JsonParseUnexpectedChar{"Expected start of JSON"};
+        }
+
+        if (Utils::isCharQuote(c)) {
+            current = index.next(current + 1);
+            if (current == end) {
+                throw JsonParseUnexpectedEof{"Expected end of the string"};
+            }
+            tape->positions.push_back(current);
+            tape->closes.push_back(0);
+
+            // Структурный индекс не отмечает текст сразу за закрывающей кавычкой, поэтому он проверяется здесь.
+            // Строка - ключ, если она открывает объект или идет в нем за запятой
+            if (!isTokenEnd(current + 1, end)) {
+                char previous = *tape->positions[number - 1];
+                bool isKey = *tape->positions[open.back()] == '{' && (previous == '{' || previous == ',');
+                throw JsonParseUnexpectedChar{isKey ? "Expected ':'" : "Expected ','"};
+            }
+        } else if (c == '[' || c == '{') {
+            open.push_back(number);
+        } else if (c == ']' || c == '}') {
+            if (open.empty() || *tape->positions[open.back()] != (c == ']' ? '[' : '{')) {
+                throw JsonParseUnexpectedChar{"Unexpected char '" + std::string{c} + "'"};
+            }
+            tape->closes[open.back()] = number;
+            open.pop_back();
+
+            if (open.empty()) {
+                if (index.next(current + 1) != end) {
+                    throw JsonParseUnexpectedChar{"Excepted end of JSON"};
+                }
+                break;
+            }
+        }
+    }
+
+    if (tape->positions.empty()) {
+        throw JsonParseUnexpectedEof{"Expected start of JSON"};
+    }
+    if (!open.empty()) {
+        throw JsonParseUnexpectedEof{*tape->positions[open.back()] == '[' ? "Expected end of array" : "Expected end of object"};
+    }
+
+    JsonLazyDocument document;
+    document.rootValue = std::make_unique<JsonLazyValue>();
+    document.rootValue->initialize(tape.get(), 0);
+    document.tape = std::move(tape);
+    return document;
+}
\ No newline at end of file
@@ -0,0 +1,102 @@
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <memory>
+
+#include "JsonFile.hpp"
+#include "JsonLines.hpp"
+#include "JsonParallel.hpp"
+#include "JsonParser.hpp"
+#include "Utils.hpp"
+
+namespace
+{
+    // Кусок не меньше, чтобы накладные расходы на задачу были незаметны
+    constexpr size_t MIN_CHUNK_SIZE = 1 << 16;
+
+    // Кусков больше, чем потоков, чтобы потоки выравнивали нагрузку между собой
+    constexpr size_t CHUNKS_PER_THREAD = 4;
+}
+
+std::vector<Json> JsonLines::parse(std::string_view input, unsigned threads)
+{
+    std::vector<std::string_view> chunks = split(input, threads);
+    std::vector<std::vector<Json>> results(chunks.size());
+
+    JsonParallel::forEach(chunks.size(), threads, [&](size_t i) {
+        parseChunk(chunks[i], 0, [&results, i](size_t, Json &&record) {
+            results[i].push_back(std::move(record));
+        });
+    });
+
+    size_t total = 0;
+    for (const std::vector<Json> &result : results) {
+        total += result.size();
+    }
+
+    std::vector<Json> records;
+    records.reserve(total);
+    for (std::vector<Json> &result : results) {
+        std::move(result.begin(), result.end(), std::back_inserter(records));
+    }
+    return records;
+}
+
+void JsonLines::parse(std::string_view input, const Callback &callback, unsigned threads)
+{
+    std::vector<std::string_view> chunks = split(input, threads);
+
+    JsonParallel::forEach(chunks.size(), threads, [&](size_t i) {
+        parseChunk(chunks[i], static_cast<size_t>(chunks[i].data() - input.data()), callback);
+    });
+}
+
+std::vector<Json> JsonLines::parseFile(const std::string &pathToFile, unsigned threads)
+{
+    JsonFile file(pathToFile);
+    return parse(file.view(), threads);
+}
+
+void JsonLines::parseFile(const std::string &pathToFile, const Callback &callback, unsigned threads)
+{
+    JsonFile file(pathToFile);
+    parse(file.view(), callback, threads);
+}
+
+std::vector<std::string_view> JsonLines::split(std::string_view input, unsigned threads)
+{
+    size_t chunkCount = JsonParallel::threadCount(threads) * CHUNKS_PER_THREAD;
+    size_t chunkSize = std::max(MIN_CHUNK_SIZE, input.size() / chunkCount + 1);
+
+    std::vector<std::string_view> chunks;
+    size_t begin = 0;
+    while (begin < input.size()) {
+        // Кусок продлевается до ближайшего перевода строки
+        size_t end = input.find('\n', std::min(begin + chunkSize, input.size()) - 1);
+        end = end == std::string_view::npos ? input.size() : end + 1;
+        chunks.push_back(input.substr(begin, end - begin));
+        begin = end;
+    }
+    return chunks;
+}
+
+template <typename Consumer>
+void JsonLines::parseChunk(std::string_view chunk, size_t offset, const Consumer &consumer)
+{
+    const char *current = chunk.data();
+    const char *end = chunk.data() + chunk.size();
+    while (current != end) {
+        auto lineEnd = static_cast<const char *>(std::memchr(current, '\n', static_cast<size_t>(end - current)));
+        if (!lineEnd) {
+            lineEnd = end;
+        }
+
+        // Пустые строки и строки из одних пробелов пропускаются
+        if (std::find_if_not(current, lineEnd, Utils::isCharSpace) != lineEnd) {
+            std::unique_ptr<Json> record{JsonParser::parse(current, lineEnd)};
+            consumer(offset + static_cast<size_t>(current - chunk.data()), std::move(*record));
+        }
+
+        current = lineEnd == end ? end : lineEnd + 1;
+    }
+}
\ No newline at end of file
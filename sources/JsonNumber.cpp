@@ -0,0 +1,165 @@
+#include <charconv>
+#include <limits>
+#include "JsonNumber.hpp"
+
+namespace
+{
+
+// Точные степени десяти, представимые в double
+constexpr double POWERS_OF_TEN[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+// Больше 19 цифр в uint64_t может не поместиться
+constexpr int MAX_EXACT_DIGITS = 19;
+
+bool isDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+}
+
+double JsonNumber::toDouble() const
+{
+    switch (type) {
+        case Type::Integer:
+            return static_cast<double>(integer);
+        case Type::UnsignedInteger:
+            return static_cast<double>(unsignedInteger);
+        default:
+            return real;
+    }
+}
+
+const char *JsonNumber::parse(const char *begin, const char *end, JsonNumber &number)
+{
+    const char *p = begin;
+    bool negative = p != end && *p == '-';
+    if (negative) {
+        p++;
+    }
+
+    if (p == end || !isDigit(*p)) {
+        return nullptr;
+    }
+
+    // Значащие цифры мантиссы (первые MAX_EXACT_DIGITS) и их количество
+    uint64_t mantissa = 0;
+    int digits = 0;
+    int64_t exponent = 0;
+    auto addDigit = [&mantissa, &digits, &exponent](char c) {
+        if (digits < MAX_EXACT_DIGITS) {
+            mantissa = mantissa * 10 + static_cast<uint64_t>(c - '0');
+            if (mantissa != 0) {
+                digits++;
+            }
+        } else {
+            // Цифры сверх точности только сдвигают порядок
+            digits++;
+            exponent++;
+        }
+    };
+
+    if (*p == '0') {
+        p++;
+    } else {
+        for (; p != end && isDigit(*p); p++) {
+            addDigit(*p);
+        }
+    }
+
+    bool isInteger = true;
+    if (p != end && *p == '.') {
+        p++;
+        if (p == end || !isDigit(*p)) {
+            return nullptr;
+        }
+        isInteger = false;
+        for (; p != end && isDigit(*p); p++) {
+            if (digits < MAX_EXACT_DIGITS) {
+                addDigit(*p);
+                exponent--;
+            } else {
+                digits++;
+            }
+        }
+    }
+
+    if (p != end && (*p == 'e' || *p == 'E')) {
+        p++;
+        bool negativeExponent = p != end && *p == '-';
+        if (p != end && (*p == '-' || *p == '+')) {
+            p++;
+        }
+        if (p == end || !isDigit(*p)) {
+            return nullptr;
+        }
+        isInteger = false;
+
+        int64_t value = 0;
+        for (; p != end && isDigit(*p); p++) {
+            // Порядок больше миллиона все равно дает 0 или бесконечность
+            if (value < 1000000) {
+                value = value * 10 + (*p - '0');
+            }
+        }
+        exponent += negativeExponent ? -value : value;
+    }
+
+    if (isInteger && digits <= MAX_EXACT_DIGITS && !(negative && mantissa == 0)) {
+        if (!negative && mantissa <= static_cast<uint64_t>(std::numeric_limits<int64_t>::max())) {
+            number.type = Type::Integer;
+            number.integer = static_cast<int64_t>(mantissa);
+            return p;
+        }
+        if (!negative) {
+            number.type = Type::UnsignedInteger;
+            number.unsignedInteger = mantissa;
+            return p;
+        }
+        if (mantissa <= uint64_t{1} << 63) {
+            number.type = Type::Integer;
+            number.integer = static_cast<int64_t>(0 - mantissa);
+            return p;
+        }
+    }
+    if (isInteger && !negative && digits == MAX_EXACT_DIGITS + 1) {
+        // 20 цифр еще могут поместиться в uint64_t
+        uint64_t value;
+        auto[ptr, error] = std::from_chars(begin, p, value);
+        if (error == std::errc{} && ptr == p) {
+            number.type = Type::UnsignedInteger;
+            number.unsignedInteger = value;
+            return p;
+        }
+    }
+
+    number.type = Type::Double;
+
+    // Быстрый путь Клингера: мантисса и степень десяти точно представимы в double,
+    // значит результат одного умножения или деления правильно округлен
+    constexpr uint64_t MAX_EXACT_MANTISSA = uint64_t{1} << 53;
+    if (digits <= MAX_EXACT_DIGITS && mantissa <= MAX_EXACT_MANTISSA && exponent >= -22 && exponent <= 22) {
+        auto value = static_cast<double>(mantissa);
+        value = exponent < 0 ? value / POWERS_OF_TEN[-exponent] : value * POWERS_OF_TEN[exponent];
+        number.real = negative ? -value : value;
+        return p;
+    }
+
+    // Общий случай: from_chars с корректным округлением (Eisel-Lemire в современных библиотеках)
+    double value;
+    auto[ptr, error] = std::from_chars(begin, p, value);
+    if (error == std::errc::result_out_of_range && ptr == p && exponent + digits <= 0) {
+        // Потеря значимости: число меньше наименьшего double округляется до нуля со знаком
+        number.real = negative ? -0.0 : 0.0;
+        return p;
+    }
+    if (error != std::errc{} || ptr != p) {
+        // В том числе переполнение: бесконечность в JSON не представима
+        return nullptr;
+    }
+    number.real = value;
+    return p;
+}
\ No newline at end of file
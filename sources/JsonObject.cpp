@@ -0,0 +1,114 @@
+#include "JsonKeyPool.hpp"
+#include "JsonObject.hpp"
+
+JsonObject::JsonObject(const JsonObject &object, std::pmr::memory_resource *resource)
+    : members(object.members, resource), index(object.index, resource)
+{}
+
+void JsonObject::reserve(size_t size)
+{
+    members.reserve(size);
+
+    // Индекс сразу нужного размера, чтобы не перестраивать его при вставках
+    if (size >= INDEX_THRESHOLD && index.size() < size * 2) {
+        size_t capacity = INDEX_THRESHOLD * 4;
+        while (capacity < size * 2) {
+            capacity *= 2;
+        }
+        rebuildIndex(capacity);
+    }
+}
+
+const JsonValue *JsonObject::find(std::string_view key, size_t keyHash) const
+{
+    if (index.empty()) {
+        for (const JsonMember &member : members) {
+            if (member.key.asString() == key) {
+                return &member.value;
+            }
+        }
+        return nullptr;
+    }
+
+    size_t slot = findSlot(key, keyHash);
+    return index[slot].member ? &members[index[slot].member - 1].value : nullptr;
+}
+
+std::pair<JsonValue *, bool> JsonObject::tryEmplace(JsonValue &&key)
+{
+    if (index.empty()) {
+        for (JsonMember &member : members) {
+            if (equal(member.key, key)) {
+                return {&member.value, false};
+            }
+        }
+
+        members.push_back(JsonMember{std::move(key), JsonValue{}});
+        if (members.size() >= INDEX_THRESHOLD) {
+            rebuildIndex(INDEX_THRESHOLD * 4);
+        }
+        return {&members.back().value, true};
+    }
+
+    std::string_view keyString = key.asString();
+    size_t keyHash = hashOf(key);
+    size_t slot = findSlot(keyString, keyHash);
+    if (index[slot].member) {
+        return {&members[index[slot].member - 1].value, false};
+    }
+
+    members.push_back(JsonMember{std::move(key), JsonValue{}});
+    index[slot] = Slot{static_cast<uint32_t>(members.size()), static_cast<uint32_t>(keyHash)};
+
+    // Заполненность не больше половины
+    if (members.size() * 2 > index.size()) {
+        rebuildIndex(index.size() * 2);
+    }
+    return {&members.back().value, true};
+}
+
+size_t JsonObject::findSlot(std::string_view key, size_t keyHash) const
+{
+    size_t mask = index.size() - 1;
+    auto shortHash = static_cast<uint32_t>(keyHash);
+    for (size_t slot = keyHash & mask;; slot = (slot + 1) & mask) {
+        const Slot &current = index[slot];
+        if (!current.member) {
+            return slot;
+        }
+        if (current.hash == shortHash && members[current.member - 1].key.asString() == key) {
+            return slot;
+        }
+    }
+}
+
+void JsonObject::rebuildIndex(size_t capacity)
+{
+    index.assign(capacity, Slot{0, 0});
+
+    size_t mask = capacity - 1;
+    for (size_t i = 0; i < members.size(); i++) {
+        size_t keyHash = hashOf(members[i].key);
+        size_t slot = keyHash & mask;
+        while (index[slot].member) {
+            slot = (slot + 1) & mask;
+        }
+        index[slot] = Slot{static_cast<uint32_t>(i + 1), static_cast<uint32_t>(keyHash)};
+    }
+}
+
+size_t JsonObject::hashOf(const JsonValue &key)
+{
+    if (key.flags & JsonValue::INTERNED) {
+        return JsonKeyPool::getHash(key.string);
+    }
+    return hash(key.asString());
+}
+
+bool JsonObject::equal(const JsonValue &left, const JsonValue &right)
+{
+    if ((left.flags & right.flags & JsonValue::INTERNED) && left.string != right.string) {
+        return false;
+    }
+    return left.asString() == right.asString();
+}
\ No newline at end of file
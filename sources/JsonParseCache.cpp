@@ -0,0 +1,192 @@
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string_view>
+
+#include "JsonCbor.hpp"
+#include "JsonCborReader.hpp"
+#include "JsonFile.hpp"
+#include "JsonParseCache.hpp"
+#include "JsonParser.hpp"
+#include "JsonReader.hpp"
+
+namespace
+{
+    // Версия формата входит в сигнатуру: образ другой версии считается устаревшим
+    constexpr char MAGIC[8] = {'J', 'S', 'O', 'N', 'C', 'B', '0', '2'};
+
+    // Заголовок образа в порядке байтов машины: образ с другой машины не совпадет и будет перестроен
+    struct ImageHeader
+    {
+        char magic[sizeof(MAGIC)];
+        uint64_t sourceSize;
+        int64_t sourceSeconds;
+        int64_t sourceNanoseconds;
+        uint64_t sourceHash;
+        uint64_t imageSize;
+        uint64_t imageHash;
+        uint64_t exact;                     // 1, если целые и дробные числа различаются, как в тексте
+    };
+
+    // Хэш стандартной библиотеки может отличаться между ее версиями, но тогда образ лишь перестроится
+    uint64_t hashOf(std::string_view data)
+    {
+        return std::hash<std::string_view>{}(data);
+    }
+
+    // Ключ образа: сигнатура, размер, время изменения и хэш содержимого исходного файла
+    ImageHeader makeHeader(const std::string &pathToFile, const JsonFile &source)
+    {
+        struct stat status{};
+        if (::stat(pathToFile.c_str(), &status) != 0) {
+            throw JsonParseFileException("Cannot read file: " + pathToFile);
+        }
+
+        ImageHeader header{};
+        std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+        header.sourceSize = source.view().size();
+        header.sourceSeconds = status.st_mtim.tv_sec;
+        header.sourceNanoseconds = status.st_mtim.tv_nsec;
+        header.sourceHash = hashOf(source.view());
+        return header;
+    }
+
+    // Отображенный образ, если он соответствует заголовку expected и не поврежден.
+    // Если requireExact, подходит только образ, в котором целые числа отличаются от дробных
+    std::shared_ptr<const JsonFile> findImage(const std::string &cachePath, const ImageHeader &expected,
+                                              bool requireExact)
+    {
+        std::shared_ptr<const JsonFile> image;
+        try {
+            image = std::make_shared<const JsonFile>(cachePath);
+        } catch (const JsonParseFileException &) {
+            return nullptr;
+        }
+
+        std::string_view view = image->view();
+        ImageHeader header{};
+        if (view.size() < sizeof(header)) {
+            return nullptr;
+        }
+        std::memcpy(&header, view.data(), sizeof(header));
+        std::string_view payload = view.substr(sizeof(header));
+
+        if (std::memcmp(header.magic, expected.magic, sizeof(MAGIC)) != 0
+            || header.sourceSize != expected.sourceSize
+            || header.sourceSeconds != expected.sourceSeconds
+            || header.sourceNanoseconds != expected.sourceNanoseconds
+            || header.sourceHash != expected.sourceHash
+            || header.imageSize != payload.size()
+            || header.imageHash != hashOf(payload)
+            || (requireExact && !header.exact)) {
+            return nullptr;
+        }
+        return image;
+    }
+
+    std::string_view getPayload(const JsonFile &image)
+    {
+        return image.view().substr(sizeof(ImageHeader));
+    }
+
+    // Образ пишется во временный файл и переименовывается, поэтому читатели не видят его частично.
+    // Дробные числа пишутся как дробные (см. JsonCbor), чтобы при попадании тип числа был тем же,
+    // что и при разборе текста. exact - различает ли само значение value целые и дробные числа
+    template <typename Value>
+    void store(const std::string &cachePath, ImageHeader header, const Value &value, bool exact)
+    {
+        static std::atomic<unsigned> counter{0};
+        std::string temporaryPath = cachePath + ".tmp." + std::to_string(::getpid()) + "."
+            + std::to_string(counter++);
+
+        std::string image(sizeof(header), '\0');
+        JsonCbor::encode(value, image, true);
+        header.exact = exact;
+        std::string_view payload = std::string_view(image).substr(sizeof(header));
+        header.imageSize = payload.size();
+        header.imageHash = hashOf(payload);
+        std::memcpy(image.data(), &header, sizeof(header));
+
+        std::error_code error;
+        std::filesystem::create_directories(std::filesystem::path(cachePath).parent_path(), error);
+        {
+            std::ofstream output(temporaryPath, std::ios::binary | std::ios::trunc);
+            output.write(image.data(), static_cast<std::streamsize>(image.size()));
+            output.close();
+            if (!output) {
+                std::filesystem::remove(temporaryPath, error);
+                return;
+            }
+        }
+        std::filesystem::rename(temporaryPath, cachePath, error);
+        if (error) {
+            std::filesystem::remove(temporaryPath, error);
+        }
+    }
+}
+
+Json JsonParseCache::parseFile(const std::string &pathToFile, bool preciseIntegers)
+{
+    JsonFile source(pathToFile);
+    ImageHeader header = makeHeader(pathToFile, source);
+    std::string cachePath = getCachePath(pathToFile);
+
+    // Без preciseIntegers подходит любой образ: при чтении все числа и так становятся double
+    if (std::shared_ptr<const JsonFile> image = findImage(cachePath, header, preciseIntegers)) {
+        try {
+            Json result = JsonCbor::decode(getPayload(*image), preciseIntegers);
+            hits++;
+            return result;
+        } catch (const JsonParseException &) {
+        }
+    }
+
+    std::unique_ptr<Json> result{JsonParser::parse(source.begin(), source.end(), preciseIntegers)};
+    misses++;
+    store(cachePath, header, *result, preciseIntegers);
+    return std::move(*result);
+}
+
+JsonDocument JsonParseCache::parseDocument(const std::string &pathToFile, std::shared_ptr<JsonKeyPool> keyPool)
+{
+    auto source = std::make_shared<const JsonFile>(pathToFile);
+    ImageHeader header = makeHeader(pathToFile, *source);
+    std::string cachePath = getCachePath(pathToFile);
+
+    // Строки документа указывают прямо в отображенный образ, который документ удерживает
+    if (std::shared_ptr<const JsonFile> image = findImage(cachePath, header, true)) {
+        try {
+            std::string_view payload = getPayload(*image);
+            JsonDocument document = JsonDocument::parsePinned<JsonCborReader>(std::move(image), payload, keyPool);
+            hits++;
+            return document;
+        } catch (const JsonParseException &) {
+        }
+    }
+
+    std::string_view input = source->view();
+    JsonDocument document = JsonDocument::parsePinned<JsonReader>(std::move(source), input, std::move(keyPool));
+    misses++;
+    store(cachePath, header, document.root(), true);
+    return document;
+}
+
+std::string JsonParseCache::getCachePath(const std::string &pathToFile) const
+{
+    if (cacheDirectory.empty()) {
+        return pathToFile + EXTENSION;
+    }
+
+    // Одноименные файлы из разных каталогов различаются хэшем абсолютного пути
+    std::filesystem::path path = std::filesystem::absolute(pathToFile).lexically_normal();
+    char suffix[17];
+    std::snprintf(suffix, sizeof(suffix), "%016llx", static_cast<unsigned long long>(hashOf(path.string())));
+    std::string name = path.filename().string() + "." + suffix + EXTENSION;
+    return (std::filesystem::path(cacheDirectory) / name).string();
+}
\ No newline at end of file
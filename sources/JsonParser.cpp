@@ -1,245 +1,123 @@
-#include <boost/algorithm/string.hpp>
-#include <functional>
-#include <iostream>
-#include <boost/lexical_cast/bad_lexical_cast.hpp>
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "JsonDomBuilder.hpp"
+#include "JsonParallel.hpp"
 #include "JsonParser.hpp"
-#include "Utils.hpp"
+#include "JsonReader.hpp"
 
-Json *JsonParser::parse(const std::string &string)
+namespace
 {
-    PartsType parts = fullSplit(string);
-
-    auto it = parts.cbegin();
-    std::unique_ptr<Json> result{std::any_cast<Json *>(parsePart(it, parts.cend()))};
-
-    if (it != parts.cend()) {
-        throw JsonParseUnexpectedChar{"Excepted end of JSON"};
-    }
-
-    return result.release();
-}
-
-std::optional<std::any>
-JsonParser::ejectString(std::string::const_iterator &iterator, const std::string::const_iterator &end)
-{
-    if (!Utils::isCharQuote(*iterator)) {
-        return std::nullopt;
-    }
-
-    char openQuote = *iterator;
-    auto stringStart = ++iterator;
-
-    std::string::const_iterator stringEnd;
-    do {
-        stringEnd = std::find(iterator, end, openQuote);
-        if (stringEnd == end) {
-            throw JsonParseUnexpectedEof{"Expected end of the string"};
+    // Меньшие документы быстрее разобрать в одном потоке
+    constexpr size_t PARALLEL_MIN_SIZE = 1 << 20;
+
+    constexpr size_t MIN_CHUNK_SIZE = 1 << 18;
+
+    constexpr size_t CHUNKS_PER_THREAD = 4;
+
+    using Range = std::pair<const char *, const char *>;
+
+    // Деление элементов корневого массива на диапазоны не короче chunkSize по запятым верхнего уровня.
+    // Пустой результат - корень не массив или документ некорректен
+    std::vector<Range> splitArray(const char *begin, const char *end, size_t chunkSize)
+    {
+        JsonStructuralIndex index(begin, end);
+        const char *position = index.next(begin);
+        if (position == end || *position != '[') {
+            return {};
+        }
+
+        std::vector<Range> ranges;
+        const char *rangeBegin = position + 1;
+        size_t depth = 0;
+        for (position = index.next(position + 1); position != end; position = index.next(position + 1)) {
+            char c = *position;
+            if (Utils::isCharQuote(c)) {
+                // Следующая позиция индекса - закрывающая кавычка
+                position = index.next(position + 1);
+                if (position == end) {
+                    return {};
+                }
+            } else if (c == '[' || c == '{') {
+                depth++;
+            } else if ((c == ']' || c == '}') && depth > 0) {
+                depth--;
+            } else if (c == ']') {
+                ranges.emplace_back(rangeBegin, position);
+                return index.next(position + 1) == end ? ranges : std::vector<Range>{};
+            } else if (c == '}') {
+                return {};
+            } else if (c == ',' && depth == 0 && static_cast<size_t>(position - rangeBegin) >= chunkSize) {
+                ranges.emplace_back(rangeBegin, position);
+                rangeBegin = position + 1;
+            }
         }
-
-        iterator = stringEnd;
-        iterator++;
-    } while (Utils::isCharEscaping(*(stringEnd - 1)));
-
-    std::string result(stringStart, stringEnd);
-
-    static const std::unordered_map<std::string, std::string> toReplace = {
-        {"\\\\", "\\"},
-        {"\\\"", "\""},
-        {"\\\'", "\'"},
-        {"\\n", "\n"},
-        {"\\t", "\t"},
-    };
-    for (const auto &pair : toReplace) {
-        boost::replace_all(result, pair.first, pair.second);
+        return {};
     }
-
-    return result;
 }
 
-std::optional<std::any>
-JsonParser::ejectNumber(std::string::const_iterator &iterator, const std::string::const_iterator &end)
+Json *JsonParser::parse(const std::string &string, bool preciseIntegers)
 {
-    if (!Utils::isCharNumber(*iterator)) {
-        return std::nullopt;
-    }
-
-    auto startNumber = std::find_if(iterator, end, Utils::isCharNumber);
-    if (startNumber == end) {
-        return std::nullopt;
-    }
-
-    auto endNumber = std::find_if_not(startNumber, end, Utils::isCharNumber);
-    iterator = endNumber;
-
-    std::string number = std::string(startNumber, endNumber);
-    try {
-        return Utils::stringToNumber(number);
-    } catch (boost::bad_lexical_cast &) {
-        throw JsonParseCannotParseNumber{"Cannot parse number '" + number + "'"};
-    }
+    return parse(string.data(), string.data() + string.size(), preciseIntegers);
 }
 
-std::optional<std::any>
-JsonParser::ejectKeyword(std::string::const_iterator &iterator, const std::string::const_iterator &end)
+Json *JsonParser::parse(const char *begin, const char *end, bool preciseIntegers)
 {
-    static const std::unordered_map<std::string, std::any> results = {
-        {"true", static_cast<bool>(true)},
-        {"false", static_cast<bool>(false)},
-        {"null", std::any{}},
-    };
-
-    size_t length = end - iterator;
-
-    for (const auto &pair : results) {
-        if (length < pair.first.size()) {
-            continue;
-        }
-
-        if (std::string(iterator, iterator + pair.first.size()) == pair.first) {
-            iterator += pair.first.size();
-            return pair.second;
-        }
-    }
-
-    return std::nullopt;
+    JsonDomBuilder builder{preciseIntegers};
+    JsonReader<JsonDomBuilder>{begin, end, builder}.parseRoot();
+    return builder.release();
 }
 
-JsonParser::PartsType JsonParser::fullSplit(const std::string &input)
+Json *JsonParser::parseParallel(const char *begin, const char *end, unsigned threads, bool preciseIntegers)
 {
-    std::list<std::function<
-        std::optional<std::any>(std::string::const_iterator &, const std::string::const_iterator &)
-    >> ejectors = {
-        &ejectString,
-        &ejectNumber,
-        &ejectKeyword,
-    };
-
-    PartsType splitted;
-    for (std::string::const_iterator it = input.cbegin(); it != input.cend();) {
-        std::optional<std::any> part;
-        for (auto &ejector : ejectors) {
-            part = ejector(it, input.cend());
-            if (part.has_value()) {
-                splitted.emplace_back(part.value());
-                break;
-            }
-        }
-        if (part.has_value()) {
-            continue;
-        }
-
-        if (Utils::isCharSugar(*it)) {
-            splitted.emplace_back(std::string{*it});
-            it++;
-            continue;
-        }
-        if (Utils::isCharSpace(*it)) {
-            it = std::find_if_not(it, input.cend(), Utils::isCharSpace);
-            continue;
-        }
-        throw JsonParseUnexpectedChar{"Unexpected char '" + std::string{*it} + "'"};
+    auto size = static_cast<size_t>(end - begin);
+    size_t chunkCount = JsonParallel::threadCount(threads) * CHUNKS_PER_THREAD;
 
+    std::vector<Range> ranges;
+    if (size >= PARALLEL_MIN_SIZE && chunkCount > CHUNKS_PER_THREAD) {
+        ranges = splitArray(begin, end, std::max(MIN_CHUNK_SIZE, size / chunkCount));
     }
-    return splitted;
-}
-
-std::any
-JsonParser::parsePart(std::list<std::any>::const_iterator &iterator,
-                      const std::list<std::any>::const_iterator &end,
-                      bool inStart)
-{
-    static auto startValid = [](const std::string &str) {
-        if (str.size() > 1) {
-            return false;
-        }
-
-        return boost::is_any_of("[{")(str[0]);
-    };
-
-    if (inStart && (iterator->type() != typeid(std::string) || !startValid(std::any_cast<std::string>(*iterator)))) {
-        throw JsonParseUnexpectedChar{"Expected start of JSON"};
+    if (ranges.size() < 2) {
+        return parse(begin, end, preciseIntegers);
     }
 
-    if (Utils::isAnyEqual(*iterator, std::string{"["})) {
-        return parseArray(++iterator, end);
-    }
-    if (Utils::isAnyEqual(*iterator, std::string{"{"})) {
-        return parseObject(++iterator, end);
+    std::vector<std::unique_ptr<Json>> parts(ranges.size());
+    try {
+        JsonParallel::forEach(ranges.size(), threads, [&ranges, &parts, preciseIntegers](size_t i) {
+            JsonDomBuilder builder{preciseIntegers};
+            builder.startArray();
+            JsonReader<JsonDomBuilder>{ranges[i].first, ranges[i].second, builder}.parseElements();
+            builder.endArray();
+            parts[i].reset(builder.release());
+        });
+    } catch (const JsonParseException &) {
+        return parse(begin, end, preciseIntegers);
     }
-    auto prev = iterator;
-    iterator++;
-    return *prev;
-}
-
-Json *
-JsonParser::parseArray(PartsType::const_iterator &iterator, const PartsType::const_iterator &end)
-{
-    auto jsonResult = std::make_unique<Json>(Json::ArrayType{});
 
-    if (Utils::isAnyEqual(*iterator, std::string{"]"})) {
-        iterator++;
-        return jsonResult.release();
+    // Элементы переносятся в первую часть, остальные части остаются пустыми и ничего не удаляют
+    size_t total = 0;
+    for (const std::unique_ptr<Json> &part : parts) {
+        total += part->arrayData->size();
     }
 
-    while (iterator != end) {
-        std::any part = parsePart(iterator, end, false);
-        jsonResult->addToArray(part);
-
-        if (Utils::isAnyEqual(*iterator, std::string{"]"})) {
-            iterator++;
-            return jsonResult.release();
-        }
-        if (!Utils::isAnyEqual(*iterator, std::string{","})) {
-            throw JsonParseUnexpectedChar{"Expected ','"};
-        }
-
-        iterator++;
+    Json::ArrayType &elements = *parts.front()->arrayData;
+    elements.reserve(total);
+    for (size_t i = 1; i < parts.size(); i++) {
+        Json::ArrayType &partElements = *parts[i]->arrayData;
+        std::move(partElements.begin(), partElements.end(), std::back_inserter(elements));
+        partElements.clear();
     }
-
-    throw JsonParseUnexpectedEof{"Expected end of array"};
+    return parts.front().release();
 }
 
-Json *
-JsonParser::parseObject(std::list<std::any>::const_iterator &iterator, const std::list<std::any>::const_iterator &end)
+void JsonParser::parse(const std::string &string, JsonHandler &handler)
 {
-    auto jsonResult = std::make_unique<Json>(Json::ObjectType{});
-
-    if (Utils::isAnyEqual(*iterator, std::string{"}"})) {
-        iterator++;
-        return jsonResult.release();
-    }
-
-    while (iterator != end) {
-        if (iterator->type() != typeid(std::string)) {
-            throw JsonParseUnexpectedChar{"Expected key"};
-        }
-
-        auto key = std::any_cast<std::string>(*iterator);
-        if (auto keys = jsonResult->getKeys(); std::find(keys.cbegin(), keys.cend(), key) != keys.cend()) {
-            throw JsonParseDuplicatedKeyError{"Duplicated key '" + key + "'"};
-        }
-        iterator++;
-
-        if (!Utils::isAnyEqual(*iterator, std::string{":"})) {
-            throw JsonParseUnexpectedChar{"Expected ':'"};
-        }
-
-        auto value = parsePart(++iterator, end, false);
-        jsonResult->addToObjectKey(key, value);
-        if (iterator == end) {
-            break;
-        }
-
-        if (Utils::isAnyEqual(*iterator, std::string{"}"})) {
-            iterator++;
-            return jsonResult.release();
-        }
-        if (!Utils::isAnyEqual(*iterator, std::string{","})) {
-            throw JsonParseUnexpectedChar{"Expected ','"};
-        }
-
-        iterator++;
-    }
-
-    throw JsonParseUnexpectedEof{"Expected end of array"};
+    parse(string.data(), string.data() + string.size(), handler);
 }
+
+void JsonParser::parse(const char *begin, const char *end, JsonHandler &handler)
+{
+    JsonReader<JsonHandler>{begin, end, handler}.parseRoot();
+}
\ No newline at end of file
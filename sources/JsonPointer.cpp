@@ -0,0 +1,195 @@
+#include <algorithm>
+#include <charconv>
+
+#include "JsonObject.hpp"
+#include "JsonPointer.hpp"
+
+JsonPointer::JsonPointer(std::string_view pointer)
+{
+    if (pointer.empty()) {
+        return;
+    }
+    if (pointer.front() != '/') {
+        throw JsonPointerException("JSON pointer must start with '/': " + std::string(pointer));
+    }
+
+    size_t begin = 1;
+    while (true) {
+        size_t end = std::min(pointer.find('/', begin), pointer.size());
+
+        // Экранирование: "~1" - '/', "~0" - '~'
+        Token token{};
+        for (size_t i = begin; i < end; i++) {
+            if (pointer[i] != '~') {
+                token.key += pointer[i];
+            } else if (i + 1 < end && (pointer[i + 1] == '0' || pointer[i + 1] == '1')) {
+                token.key += pointer[++i] == '0' ? '~' : '/';
+            } else {
+                throw JsonPointerException("Invalid escape in JSON pointer: " + std::string(pointer));
+            }
+        }
+        token.hash = JsonObject::hash(token.key);
+
+        // Номер элемента - десятичное число без ведущих нулей
+        const std::string &key = token.key;
+        if (!key.empty() && (key == "0" || key.front() != '0')
+            && std::all_of(key.cbegin(), key.cend(), [](char c) { return c >= '0' && c <= '9'; })) {
+            token.isIndex = std::from_chars(key.data(), key.data() + key.size(), token.index).ec == std::errc{};
+        }
+        tokens.push_back(std::move(token));
+
+        if (end == pointer.size()) {
+            break;
+        }
+        begin = end + 1;
+    }
+}
+
+std::string JsonPointer::toString() const
+{
+    std::string result;
+    for (const Token &token : tokens) {
+        result += '/';
+        for (char c : token.key) {
+            if (c == '~') {
+                result += "~0";
+            } else if (c == '/') {
+                result += "~1";
+            } else {
+                result += c;
+            }
+        }
+    }
+    return result;
+}
+
+const JsonValue *JsonPointer::find(const JsonValue &value) const
+{
+    const JsonValue *current = &value;
+    for (const Token &token : tokens) {
+        current = step(*current, token);
+        if (!current) {
+            return nullptr;
+        }
+    }
+    return current;
+}
+
+const std::any *JsonPointer::find(const Json &json) const
+{
+    const Json *current = &json;
+    const std::any *result = nullptr;
+    for (const Token &token : tokens) {
+        if (!current) {
+            return nullptr;
+        }
+        result = step(*current, token);
+        current = asJson(result);
+    }
+    return result;
+}
+
+const JsonValue &JsonPointer::get(const JsonValue &value) const
+{
+    const JsonValue *result = find(value);
+    if (!result) {
+        throw JsonUnexpectedKey("Expected JSON pointer: " + toString());
+    }
+    return *result;
+}
+
+const JsonValue *JsonPointer::step(const JsonValue &value, const Token &token)
+{
+    if (value.is_object()) {
+        return value.asObject().find(token.key, token.hash);
+    }
+    if (value.is_array() && token.isIndex && token.index < value.getSize()) {
+        return &value.asArray()[token.index];
+    }
+    return nullptr;
+}
+
+const std::any *JsonPointer::step(const Json &json, const Token &token)
+{
+    if (json.objectData) {
+        auto found = json.objectData->find(token.key);
+        return found != json.objectData->cend() ? &found->second : nullptr;
+    }
+    if (json.arrayData && token.isIndex && token.index < json.arrayData->size()) {
+        return &(*json.arrayData)[token.index];
+    }
+    return nullptr;
+}
+
+const Json *JsonPointer::asJson(const std::any *value)
+{
+    if (!value) {
+        return nullptr;
+    }
+    auto json = std::any_cast<Json *>(value);
+    return json ? *json : nullptr;
+}
+
+JsonPointerBatch::JsonPointerBatch(const std::vector<JsonPointer> &pointers)
+    : nodes(1), pointerCount(pointers.size())
+{
+    for (size_t i = 0; i < pointers.size(); i++) {
+        size_t node = 0;
+        for (const JsonPointer::Token &token : pointers[i].tokens) {
+            const std::vector<size_t> &children = nodes[node].children;
+            auto child = std::find_if(children.cbegin(), children.cend(), [this, &token](size_t index) {
+                return nodes[index].token == token;
+            });
+            if (child != children.cend()) {
+                node = *child;
+            } else {
+                nodes.push_back(Node{token, {}, {}});
+                nodes[node].children.push_back(nodes.size() - 1);
+                node = nodes.size() - 1;
+            }
+        }
+        nodes[node].results.push_back(i);
+    }
+}
+
+std::vector<const JsonValue *> JsonPointerBatch::find(const JsonValue &value) const
+{
+    std::vector<const JsonValue *> results(pointerCount);
+    walk(0, &value, results);
+    return results;
+}
+
+std::vector<const std::any *> JsonPointerBatch::find(const Json &json) const
+{
+    std::vector<const std::any *> results(pointerCount);
+    walk(0, &json, nullptr, results);
+    return results;
+}
+
+void JsonPointerBatch::walk(size_t node, const JsonValue *value, std::vector<const JsonValue *> &results) const
+{
+    for (size_t result : nodes[node].results) {
+        results[result] = value;
+    }
+    for (size_t child : nodes[node].children) {
+        if (const JsonValue *childValue = JsonPointer::step(*value, nodes[child].token)) {
+            walk(child, childValue, results);
+        }
+    }
+}
+
+void JsonPointerBatch::walk(size_t node, const Json *json, const std::any *value,
+                            std::vector<const std::any *> &results) const
+{
+    for (size_t result : nodes[node].results) {
+        results[result] = value;
+    }
+    if (!json) {
+        return;
+    }
+    for (size_t child : nodes[node].children) {
+        if (const std::any *childValue = JsonPointer::step(*json, nodes[child].token)) {
+            walk(child, JsonPointer::asJson(childValue), childValue, results);
+        }
+    }
+}
\ No newline at end of file
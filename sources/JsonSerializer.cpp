@@ -0,0 +1,257 @@
+#include <cstring>
+#include <memory>
+
+#include "JsonFormat.hpp"
+#include "JsonSerializer.hpp"
+
+namespace
+{
+
+// Вывод подсчетом размера, без записи
+class CountingOutput
+{
+public:
+    void put(char)
+    {
+        size++;
+    }
+
+    void write(const char *, size_t count)
+    {
+        size += count;
+    }
+
+    void quoted(std::string_view string)
+    {
+        size += JsonFormat::quotedSize(string);
+    }
+
+    template <typename T>
+    void number(T value)
+    {
+        char buffer[JsonFormat::MAX_NUMBER_SIZE];
+        size += static_cast<size_t>(JsonFormat::writeNumber(buffer, value) - buffer);
+    }
+
+    size_t size = 0;
+};
+
+// Вывод в заранее выделенную память точного размера
+class PointerOutput
+{
+public:
+    void put(char c)
+    {
+        *current++ = c;
+    }
+
+    void write(const char *data, size_t count)
+    {
+        std::memcpy(current, data, count);
+        current += count;
+    }
+
+    void quoted(std::string_view string)
+    {
+        current = JsonFormat::writeQuoted(current, string);
+    }
+
+    template <typename T>
+    void number(T value)
+    {
+        current = JsonFormat::writeNumber(current, value);
+    }
+
+    char *current;
+};
+
+// Вывод в поток через буфер фиксированного размера
+class StreamOutput
+{
+public:
+    static constexpr size_t BUFFER_SIZE = 1 << 16;
+
+    explicit StreamOutput(std::ostream &outputStream)
+        : stream(outputStream), buffer(new char[BUFFER_SIZE])
+    {}
+
+    void put(char c)
+    {
+        reserve(1);
+        buffer[size++] = c;
+    }
+
+    void write(const char *data, size_t count)
+    {
+        if (count > BUFFER_SIZE - size) {
+            flush();
+            if (count > BUFFER_SIZE) {
+                stream.write(data, static_cast<std::streamsize>(count));
+                return;
+            }
+        }
+        std::memcpy(buffer.get() + size, data, count);
+        size += count;
+    }
+
+    void quoted(std::string_view string)
+    {
+        if (JsonFormat::maxQuotedSize(string.size()) > BUFFER_SIZE) {
+            std::string escaped(JsonFormat::quotedSize(string), '\0');
+            JsonFormat::writeQuoted(escaped.data(), string);
+            write(escaped.data(), escaped.size());
+            return;
+        }
+        reserve(JsonFormat::maxQuotedSize(string.size()));
+        size = static_cast<size_t>(JsonFormat::writeQuoted(buffer.get() + size, string) - buffer.get());
+    }
+
+    template <typename T>
+    void number(T value)
+    {
+        reserve(JsonFormat::MAX_NUMBER_SIZE);
+        size = static_cast<size_t>(JsonFormat::writeNumber(buffer.get() + size, value) - buffer.get());
+    }
+
+    void flush()
+    {
+        stream.write(buffer.get(), static_cast<std::streamsize>(size));
+        size = 0;
+    }
+
+private:
+    void reserve(size_t count)
+    {
+        if (count > BUFFER_SIZE - size) {
+            flush();
+        }
+    }
+
+    std::ostream &stream;
+    std::unique_ptr<char[]> buffer;
+    size_t size = 0;
+};
+
+}
+
+size_t JsonSerializer::getSize(const Json &json) const
+{
+    CountingOutput output;
+    writeJson(json, output, 0);
+    return output.size;
+}
+
+std::string JsonSerializer::dump(const Json &json) const
+{
+    std::string result;
+    dump(json, result);
+    return result;
+}
+
+void JsonSerializer::dump(const Json &json, std::string &output) const
+{
+    size_t offset = output.size();
+    output.resize(offset + getSize(json));
+
+    PointerOutput pointer{output.data() + offset};
+    writeJson(json, pointer, 0);
+}
+
+void JsonSerializer::write(const Json &json, std::ostream &stream) const
+{
+    StreamOutput output{stream};
+    writeJson(json, output, 0);
+    output.flush();
+}
+
+template <typename Output>
+void JsonSerializer::writeJson(const Json &json, Output &output, size_t depth) const
+{
+    if (json.objectData) {
+        if (json.objectData->empty()) {
+            output.write("{}", 2);
+            return;
+        }
+
+        output.put('{');
+        bool first = true;
+        for (const auto &pair : *json.objectData) {
+            if (!first) {
+                output.put(',');
+            }
+            first = false;
+
+            writeNewLine(output, depth + 1);
+            output.quoted(pair.first);
+            if (indent < 0) {
+                output.put(':');
+            } else {
+                output.write(": ", 2);
+            }
+            writeAny(pair.second, output, depth + 1);
+        }
+        writeNewLine(output, depth);
+        output.put('}');
+    } else if (json.arrayData) {
+        if (json.arrayData->empty()) {
+            output.write("[]", 2);
+            return;
+        }
+
+        output.put('[');
+        bool first = true;
+        for (const std::any &element : *json.arrayData) {
+            if (!first) {
+                output.put(',');
+            }
+            first = false;
+
+            writeNewLine(output, depth + 1);
+            writeAny(element, output, depth + 1);
+        }
+        writeNewLine(output, depth);
+        output.put(']');
+    } else {
+        output.write("null", 4);
+    }
+}
+
+template <typename Output>
+void JsonSerializer::writeAny(const std::any &value, Output &output, size_t depth) const
+{
+    const std::type_info &type = value.type();
+    if (type == typeid(Json *)) {
+        writeJson(*std::any_cast<Json *>(value), output, depth);
+    } else if (type == typeid(std::string)) {
+        output.quoted(*std::any_cast<std::string>(&value));
+    } else if (type == typeid(double)) {
+        output.number(*std::any_cast<double>(&value));
+    } else if (type == typeid(bool)) {
+        if (*std::any_cast<bool>(&value)) {
+            output.write("true", 4);
+        } else {
+            output.write("false", 5);
+        }
+    } else if (!value.has_value()) {
+        output.write("null", 4);
+    } else if (type == typeid(int64_t)) {
+        output.number(*std::any_cast<int64_t>(&value));
+    } else if (type == typeid(uint64_t)) {
+        output.number(*std::any_cast<uint64_t>(&value));
+    } else {
+        throw JsonUnexpectedType("Cannot serialize value of type " + std::string(type.name()));
+    }
+}
+
+template <typename Output>
+void JsonSerializer::writeNewLine(Output &output, size_t depth) const
+{
+    if (indent < 0) {
+        return;
+    }
+
+    output.put('\n');
+    for (size_t i = 0; i < depth * static_cast<size_t>(indent); i++) {
+        output.put(' ');
+    }
+}
\ No newline at end of file
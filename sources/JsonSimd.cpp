@@ -0,0 +1,193 @@
+#include "JsonSimd.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define JSON_SIMD_X86
+#endif
+
+namespace
+{
+
+using JsonSimd::BlockMasks;
+using JsonSimd::BLOCK_SIZE;
+
+BlockMasks classifyScalar(const char *block)
+{
+    BlockMasks masks{};
+    for (size_t i = 0; i < BLOCK_SIZE; i++) {
+        uint64_t bit = uint64_t{1} << i;
+        switch (block[i]) {
+            case ' ':
+            case '\t':
+            case '\r':
+            case '\n':
+                masks.space |= bit;
+                break;
+            case ',':
+            case ':':
+            case '[':
+            case ']':
+            case '{':
+            case '}':
+                masks.structural |= bit;
+                break;
+            case '"':
+                masks.quote |= bit;
+                break;
+            case '\'':
+                masks.singleQuote |= bit;
+                break;
+            case '\\':
+                masks.backslash |= bit;
+                break;
+            default:
+                break;
+        }
+    }
+    return masks;
+}
+
+#ifdef JSON_SIMD_X86
+
+__attribute__((target("sse4.2")))
+uint64_t equalMask16(__m128i data, char c)
+{
+    return static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(data, _mm_set1_epi8(c))));
+}
+
+// Маска байт, входящих в набор set длины length (PCMPESTRM, нулевые байты не мешают)
+__attribute__((target("sse4.2")))
+uint64_t anyOfMask16(__m128i data, __m128i set, int length)
+{
+    __m128i mask = _mm_cmpestrm(set, length, data, 16, _SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY | _SIDD_BIT_MASK);
+    return static_cast<uint16_t>(_mm_cvtsi128_si32(mask));
+}
+
+__attribute__((target("sse4.2")))
+BlockMasks classifySse42(const char *block)
+{
+    const __m128i spaces = _mm_setr_epi8(' ', '\t', '\r', '\n', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i structurals = _mm_setr_epi8(',', ':', '[', ']', '{', '}', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+
+    BlockMasks masks{};
+    for (size_t offset = 0; offset < BLOCK_SIZE; offset += 16) {
+        __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block + offset));
+
+        masks.space |= anyOfMask16(data, spaces, 4) << offset;
+        masks.structural |= anyOfMask16(data, structurals, 6) << offset;
+        masks.quote |= equalMask16(data, '"') << offset;
+        masks.singleQuote |= equalMask16(data, '\'') << offset;
+        masks.backslash |= equalMask16(data, '\\') << offset;
+    }
+    return masks;
+}
+
+__attribute__((target("avx2")))
+uint64_t toMask64(__m256i low, __m256i high)
+{
+    return static_cast<uint32_t>(_mm256_movemask_epi8(low))
+        | (static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(high))) << 32);
+}
+
+__attribute__((target("avx2")))
+__m256i equal32(__m256i data, char c)
+{
+    return _mm256_cmpeq_epi8(data, _mm256_set1_epi8(c));
+}
+
+__attribute__((target("avx2")))
+__m256i spaces32(__m256i data)
+{
+    return _mm256_or_si256(
+        _mm256_or_si256(equal32(data, ' '), equal32(data, '\t')),
+        _mm256_or_si256(equal32(data, '\r'), equal32(data, '\n'))
+    );
+}
+
+__attribute__((target("avx2")))
+__m256i structurals32(__m256i data)
+{
+    return _mm256_or_si256(
+        _mm256_or_si256(
+            _mm256_or_si256(equal32(data, ','), equal32(data, ':')),
+            _mm256_or_si256(equal32(data, '['), equal32(data, ']'))
+        ),
+        _mm256_or_si256(equal32(data, '{'), equal32(data, '}'))
+    );
+}
+
+__attribute__((target("avx2")))
+BlockMasks classifyAvx2(const char *block)
+{
+    __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(block));
+    __m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(block + 32));
+
+    BlockMasks masks{};
+    masks.space = toMask64(spaces32(low), spaces32(high));
+    masks.structural = toMask64(structurals32(low), structurals32(high));
+    masks.quote = toMask64(equal32(low, '"'), equal32(high, '"'));
+    masks.singleQuote = toMask64(equal32(low, '\''), equal32(high, '\''));
+    masks.backslash = toMask64(equal32(low, '\\'), equal32(high, '\\'));
+    return masks;
+}
+
+#endif
+
+using ClassifyFunction = BlockMasks (*)(const char *);
+
+ClassifyFunction functionFor(JsonSimd::Implementation implementation)
+{
+    switch (implementation) {
+#ifdef JSON_SIMD_X86
+        case JsonSimd::Implementation::Avx2:
+            return &classifyAvx2;
+        case JsonSimd::Implementation::Sse42:
+            return &classifySse42;
+#endif
+        default:
+            return &classifyScalar;
+    }
+}
+
+}
+
+JsonSimd::Implementation JsonSimd::bestImplementation()
+{
+    static const Implementation best = [] {
+        if (isSupported(Implementation::Avx2)) {
+            return Implementation::Avx2;
+        }
+        if (isSupported(Implementation::Sse42)) {
+            return Implementation::Sse42;
+        }
+        return Implementation::Scalar;
+    }();
+    return best;
+}
+
+bool JsonSimd::isSupported(Implementation implementation)
+{
+    switch (implementation) {
+#ifdef JSON_SIMD_X86
+        case Implementation::Avx2:
+            return __builtin_cpu_supports("avx2");
+        case Implementation::Sse42:
+            return __builtin_cpu_supports("sse4.2");
+#endif
+        case Implementation::Scalar:
+            return true;
+        default:
+            return false;
+    }
+}
+
+JsonSimd::BlockMasks JsonSimd::classify(const char *block)
+{
+    static const ClassifyFunction function = functionFor(bestImplementation());
+    return function(block);
+}
+
+JsonSimd::BlockMasks JsonSimd::classify(const char *block, Implementation implementation)
+{
+    return functionFor(implementation)(block);
+}
\ No newline at end of file
@@ -0,0 +1,129 @@
+#include <cstring>
+#include "JsonException.hpp"
+#include "JsonString.hpp"
+
+namespace
+{
+
+uint32_t readHex4(const char *&p, const char *end)
+{
+    if (end - p < 4) {
+        throw JsonParseInvalidEscape{"Expected 4 hex digits after '\\u'"};
+    }
+
+    uint32_t value = 0;
+    for (int i = 0; i < 4; i++, p++) {
+        char c = *p;
+        uint32_t digit;
+        if (c >= '0' && c <= '9') {
+            digit = c - '0';
+        } else if (c >= 'a' && c <= 'f') {
+            digit = c - 'a' + 10;
+        } else if (c >= 'A' && c <= 'F') {
+            digit = c - 'A' + 10;
+        } else {
+            throw JsonParseInvalidEscape{"Expected 4 hex digits after '\\u'"};
+        }
+        value = value << 4 | digit;
+    }
+    return value;
+}
+
+char *writeUtf8(uint32_t codePoint, char *out)
+{
+    if (codePoint < 0x80) {
+        *out++ = static_cast<char>(codePoint);
+    } else if (codePoint < 0x800) {
+        *out++ = static_cast<char>(0xC0 | codePoint >> 6);
+        *out++ = static_cast<char>(0x80 | (codePoint & 0x3F));
+    } else if (codePoint < 0x10000) {
+        *out++ = static_cast<char>(0xE0 | codePoint >> 12);
+        *out++ = static_cast<char>(0x80 | (codePoint >> 6 & 0x3F));
+        *out++ = static_cast<char>(0x80 | (codePoint & 0x3F));
+    } else {
+        *out++ = static_cast<char>(0xF0 | codePoint >> 18);
+        *out++ = static_cast<char>(0x80 | (codePoint >> 12 & 0x3F));
+        *out++ = static_cast<char>(0x80 | (codePoint >> 6 & 0x3F));
+        *out++ = static_cast<char>(0x80 | (codePoint & 0x3F));
+    }
+    return out;
+}
+
+uint32_t readCodePoint(const char *&p, const char *end)
+{
+    uint32_t codePoint = readHex4(p, end);
+    if (codePoint >= 0xDC00 && codePoint <= 0xDFFF) {
+        throw JsonParseInvalidEscape{"Unexpected low surrogate"};
+    }
+    if (codePoint < 0xD800 || codePoint > 0xDBFF) {
+        return codePoint;
+    }
+
+    // Старший суррогат, следом обязан идти младший
+    if (end - p < 2 || p[0] != '\\' || p[1] != 'u') {
+        throw JsonParseInvalidEscape{"Expected low surrogate"};
+    }
+    p += 2;
+    uint32_t low = readHex4(p, end);
+    if (low < 0xDC00 || low > 0xDFFF) {
+        throw JsonParseInvalidEscape{"Expected low surrogate"};
+    }
+    return 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+}
+
+}
+
+size_t JsonString::decode(const char *begin, const char *end, char *output)
+{
+    char *out = output;
+    const char *p = begin;
+    while (true) {
+        // memchr векторизован в стандартной библиотеке
+        auto escape = static_cast<const char *>(std::memchr(p, '\\', end - p));
+        const char *spanEnd = escape ? escape : end;
+        std::memcpy(out, p, spanEnd - p);
+        out += spanEnd - p;
+        if (!escape) {
+            return out - output;
+        }
+
+        p = escape + 1;
+        if (p == end) {
+            throw JsonParseInvalidEscape{"Unfinished escape sequence"};
+        }
+        switch (char c = *p++) {
+            case '"':
+            case '\\':
+            case '/':
+            case '\'':
+                *out++ = c;
+                break;
+            case 'b':
+                *out++ = '\b';
+                break;
+            case 'f':
+                *out++ = '\f';
+                break;
+            case 'n':
+                *out++ = '\n';
+                break;
+            case 'r':
+                *out++ = '\r';
+                break;
+            case 't':
+                *out++ = '\t';
+                break;
+            case 'u':
+                out = writeUtf8(readCodePoint(p, end), out);
+                break;
+            default:
+                throw JsonParseInvalidEscape{"Invalid escape sequence '\\" + std::string{c} + "'"};
+        }
+    }
+}
+
+void JsonString::decode(const char *begin, const char *end, std::string &output)
+{
+    output.resize(end - begin);
+    output.resize(decode(begin, end, output.data()));
+}
\ No newline at end of file
@@ -0,0 +1,103 @@
+#include <algorithm>
+#include <cstring>
+#include "JsonSimd.hpp"
+#include "JsonStructuralIndex.hpp"
+
+namespace
+{
+
+// Сколько блоков индексируется за один раз
+constexpr size_t WINDOW_BLOCKS = 256;
+
+// Маска битов [from, to)
+uint64_t rangeMask(unsigned from, unsigned to)
+{
+    uint64_t upper = to == 64 ? ~uint64_t{0} : (uint64_t{1} << to) - 1;
+    return upper & ~((uint64_t{1} << from) - 1);
+}
+
+}
+
+JsonStructuralIndex::JsonStructuralIndex(const char *inputBegin, const char *inputEnd)
+    : scanned(inputBegin), end(inputEnd)
+{
+    // Позиций не больше, чем байт входа: короткому входу (строке NDJSON, небольшому
+    // документу) не нужен резерв под целое окно
+    auto inputSize = static_cast<size_t>(inputEnd - inputBegin);
+    positions.reserve(std::min(WINDOW_BLOCKS * JsonSimd::BLOCK_SIZE / 4, inputSize));
+}
+
+void JsonStructuralIndex::scanWindow()
+{
+    positions.clear();
+    cursor = 0;
+
+    for (size_t i = 0; i < WINDOW_BLOCKS && scanned != end; i++) {
+        if (static_cast<size_t>(end - scanned) >= JsonSimd::BLOCK_SIZE) {
+            scanBlock(scanned, scanned);
+            scanned += JsonSimd::BLOCK_SIZE;
+            continue;
+        }
+
+        // Хвост дополняется пробелами до целого блока
+        char tail[JsonSimd::BLOCK_SIZE];
+        std::memset(tail, ' ', sizeof(tail));
+        std::memcpy(tail, scanned, end - scanned);
+        scanBlock(tail, scanned);
+        scanned = end;
+    }
+}
+
+void JsonStructuralIndex::scanBlock(const char *block, const char *base)
+{
+    JsonSimd::BlockMasks masks = JsonSimd::classify(block);
+
+    // Экранированные байты. Обратные слеши встречаются редко, поэтому перебираются по битам
+    uint64_t escaped = escapeCarry ? 1 : 0;
+    escapeCarry = false;
+    for (uint64_t slashes = masks.backslash; slashes; slashes &= slashes - 1) {
+        auto i = static_cast<unsigned>(__builtin_ctzll(slashes));
+        if (escaped & (uint64_t{1} << i)) {
+            continue;
+        }
+        if (i == 63) {
+            escapeCarry = true;
+        } else {
+            escaped |= uint64_t{1} << (i + 1);
+        }
+    }
+
+    // Строки. Допускаются оба вида кавычек, поэтому кавычки тоже перебираются по битам:
+    // внутри строки кавычка другого вида строку не закрывает
+    uint64_t opens = 0;
+    uint64_t closes = 0;
+    uint64_t stringMask = 0;
+    unsigned stringStart = 0;
+    for (uint64_t quotes = (masks.quote | masks.singleQuote) & ~escaped; quotes; quotes &= quotes - 1) {
+        auto i = static_cast<unsigned>(__builtin_ctzll(quotes));
+        if (!inString) {
+            inString = true;
+            quoteChar = block[i];
+            opens |= uint64_t{1} << i;
+            stringStart = i;
+        } else if (block[i] == quoteChar) {
+            inString = false;
+            closes |= uint64_t{1} << i;
+            stringMask |= rangeMask(stringStart, i);
+        }
+    }
+    if (inString) {
+        stringMask |= rangeMask(stringStart, 64);
+    }
+
+    // Начало прочей лексемы - непробельный байт вне строки после пробела или структурного символа
+    uint64_t structural = masks.structural & ~stringMask;
+    uint64_t separators = structural | (masks.space & ~stringMask);
+    uint64_t afterSeparator = (separators << 1) | (separatorCarry ? 1 : 0);
+    separatorCarry = (separators >> 63) != 0;
+    uint64_t atoms = ~masks.space & ~masks.structural & ~stringMask & ~closes & afterSeparator;
+
+    for (uint64_t bits = structural | opens | closes | atoms; bits; bits &= bits - 1) {
+        positions.push_back(base + __builtin_ctzll(bits));
+    }
+}
\ No newline at end of file
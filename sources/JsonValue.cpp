@@ -0,0 +1,390 @@
+#include <cstring>
+#include <limits>
+#include <memory>
+
+#include "Json.hpp"
+#include "JsonObject.hpp"
+#include "JsonReader.hpp"
+#include "JsonValue.hpp"
+#include "JsonValueBuilder.hpp"
+
+JsonValue::JsonValue(uint64_t value)
+{
+    if (value <= static_cast<uint64_t>(std::numeric_limits<int64_t>::max())) {
+        integer = static_cast<int64_t>(value);
+        type = Type::Integer;
+    } else {
+        unsignedInteger = value;
+        type = Type::UnsignedInteger;
+    }
+}
+
+JsonValue::JsonValue(std::string_view value)
+    : type(Type::String), flags(OWNED)
+{
+    size = checkedSize(value.size());
+    string = nullptr;
+    if (!value.empty()) {
+        auto data = new char[value.size()];
+        std::memcpy(data, value.data(), value.size());
+        string = data;
+    }
+}
+
+JsonValue JsonValue::array()
+{
+    JsonValue result{Type::Array, OWNED};
+    result.arrayPointer = new ArrayType(std::pmr::new_delete_resource());
+    return result;
+}
+
+JsonValue JsonValue::object()
+{
+    JsonValue result{Type::Object, OWNED};
+    result.objectPointer = new ObjectType(std::pmr::new_delete_resource());
+    return result;
+}
+
+JsonValue::JsonValue(const Json &json)
+{
+    if (json.arrayData) {
+        *this = array();
+        reserve(json.arrayData->size());
+        for (const std::any &element : *json.arrayData) {
+            arrayPointer->push_back(fromAny(element));
+        }
+    } else if (json.objectData) {
+        *this = object();
+        reserve(json.objectData->size());
+        for (const auto &pair : *json.objectData) {
+            *objectPointer->tryEmplace(JsonValue(pair.first)).first = fromAny(pair.second);
+        }
+    }
+}
+
+JsonValue::JsonValue(const JsonValue &value)
+    : unsignedInteger(value.unsignedInteger), size(value.size), type(value.type)
+{
+    switch (type) {
+        case Type::String:
+            *this = JsonValue(value.asString());
+            break;
+        case Type::Array:
+            *this = array();
+            arrayPointer->assign(value.arrayPointer->cbegin(), value.arrayPointer->cend());
+            break;
+        case Type::Object:
+            flags = OWNED;
+            objectPointer = new ObjectType(*value.objectPointer, std::pmr::new_delete_resource());
+            break;
+        default:
+            break;
+    }
+}
+
+JsonValue &JsonValue::operator=(const JsonValue &value)
+{
+    if (this != &value) {
+        // Копия строится до освобождения старого содержимого: value может ему принадлежать
+        JsonValue copy(value);
+        *this = std::move(copy);
+    }
+    return *this;
+}
+
+JsonValue &JsonValue::operator=(JsonValue &&value) noexcept
+{
+    if (this == &value) {
+        return *this;
+    }
+
+    // value может принадлежать этому значению (v = std::move(v["key"])), поэтому его поля
+    // забираются до освобождения старого содержимого
+    uint64_t adoptedData = value.unsignedInteger;
+    uint32_t adoptedSize = value.size;
+    Type adoptedType = value.type;
+    uint8_t adoptedFlags = value.flags;
+    value.type = Type::Null;
+    value.flags = 0;
+
+    if (flags & OWNED) {
+        destroy();
+    }
+    unsignedInteger = adoptedData;
+    size = adoptedSize;
+    type = adoptedType;
+    flags = adoptedFlags;
+    return *this;
+}
+
+bool JsonValue::asBool() const
+{
+    if (type != Type::Bool) {
+        throw JsonUnexpectedType("Expected JSON bool");
+    }
+    return boolean;
+}
+
+double JsonValue::asNumber() const
+{
+    switch (type) {
+        case Type::Integer:
+            return static_cast<double>(integer);
+        case Type::UnsignedInteger:
+            return static_cast<double>(unsignedInteger);
+        case Type::Double:
+            return real;
+        default:
+            throw JsonUnexpectedType("Expected JSON number");
+    }
+}
+
+int64_t JsonValue::asInteger() const
+{
+    if (type == Type::Integer) {
+        return integer;
+    }
+    // 2^63 точно представимо в double, поэтому границы проверяются без потери точности
+    if (type == Type::Double && real >= -0x1p63 && real < 0x1p63 && real == static_cast<double>(static_cast<int64_t>(real))) {
+        return static_cast<int64_t>(real);
+    }
+    throw JsonUnexpectedType("Expected JSON integer");
+}
+
+uint64_t JsonValue::asUnsignedInteger() const
+{
+    if (type == Type::Integer && integer >= 0) {
+        return static_cast<uint64_t>(integer);
+    }
+    if (type == Type::UnsignedInteger) {
+        return unsignedInteger;
+    }
+    if (type == Type::Double && real >= 0 && real < 0x1p64 && real == static_cast<double>(static_cast<uint64_t>(real))) {
+        return static_cast<uint64_t>(real);
+    }
+    throw JsonUnexpectedType("Expected JSON unsigned integer");
+}
+
+std::string_view JsonValue::asString() const
+{
+    if (type != Type::String) {
+        throw JsonUnexpectedType("Expected JSON string");
+    }
+    return std::string_view(string, size);
+}
+
+size_t JsonValue::getSize() const
+{
+    if (type == Type::Array) {
+        return arrayPointer->size();
+    }
+    if (type == Type::Object) {
+        return objectPointer->size();
+    }
+    return 0;
+}
+
+std::vector<std::string_view> JsonValue::getKeys() const
+{
+    if (type != Type::Object) {
+        throw JsonUnexpectedType("Expected JSON object");
+    }
+
+    std::vector<std::string_view> result;
+    result.reserve(objectPointer->size());
+    for (const JsonMember &member : *objectPointer) {
+        result.push_back(member.key.asString());
+    }
+    return result;
+}
+
+const JsonValue::ArrayType &JsonValue::asArray() const
+{
+    return const_cast<JsonValue *>(this)->arrayData();
+}
+
+const JsonValue::ObjectType &JsonValue::asObject() const
+{
+    return const_cast<JsonValue *>(this)->objectData();
+}
+
+JsonValue &JsonValue::operator[](std::string_view key)
+{
+    return const_cast<JsonValue &>(static_cast<const JsonValue &>(*this)[key]);
+}
+
+const JsonValue &JsonValue::operator[](std::string_view key) const
+{
+    if (type != Type::Object) {
+        throw JsonUnexpectedType("Expected JSON object");
+    }
+
+    if (const JsonValue *value = objectPointer->find(key)) {
+        return *value;
+    }
+    throw JsonUnexpectedKey("Expected JSON object key: " + std::string(key));
+}
+
+JsonValue &JsonValue::operator[](size_t index)
+{
+    return const_cast<JsonValue &>(static_cast<const JsonValue &>(*this)[index]);
+}
+
+const JsonValue &JsonValue::operator[](size_t index) const
+{
+    if (type != Type::Array) {
+        throw JsonUnexpectedType("Expected JSON array");
+    }
+    if (index >= arrayPointer->size()) {
+        throw JsonUnexpectedKey("Expected JSON array index: " + std::to_string(index));
+    }
+    return (*arrayPointer)[index];
+}
+
+void JsonValue::reserve(size_t reservedSize)
+{
+    if (type == Type::Array) {
+        arrayPointer->reserve(reservedSize);
+    } else if (type == Type::Object) {
+        objectPointer->reserve(reservedSize);
+    } else {
+        throw JsonUnexpectedType("Expected JSON object or array");
+    }
+}
+
+void JsonValue::addToObjectKey(std::string_view key, JsonValue value)
+{
+    ObjectType &members = objectData();
+    if (JsonValue *existing = members.find(key)) {
+        *existing = std::move(value);
+    } else {
+        *members.tryEmplace(JsonValue(key)).first = std::move(value);
+    }
+}
+
+void JsonValue::addToArray(JsonValue value)
+{
+    arrayData().push_back(std::move(value));
+}
+
+std::any JsonValue::toAny() const
+{
+    switch (type) {
+        case Type::Bool:
+            return boolean;
+        case Type::Integer:
+        case Type::UnsignedInteger:
+        case Type::Double:
+            return asNumber();
+        case Type::String:
+            return std::string(asString());
+        case Type::Array:
+        case Type::Object:
+            return new Json(toJson());
+        default:
+            return std::any{};
+    }
+}
+
+JsonValue JsonValue::fromAny(const std::any &any)
+{
+    if (!any.has_value()) {
+        return JsonValue{};
+    }
+    if (any.type() == typeid(Json *)) {
+        return JsonValue(*std::any_cast<Json *>(any));
+    }
+    if (any.type() == typeid(std::string)) {
+        return JsonValue(std::any_cast<const std::string &>(any));
+    }
+    if (any.type() == typeid(double)) {
+        return JsonValue(std::any_cast<double>(any));
+    }
+    if (any.type() == typeid(bool)) {
+        return JsonValue(std::any_cast<bool>(any));
+    }
+    if (any.type() == typeid(int64_t)) {
+        return JsonValue(std::any_cast<int64_t>(any));
+    }
+    if (any.type() == typeid(uint64_t)) {
+        return JsonValue(std::any_cast<uint64_t>(any));
+    }
+    throw JsonUnexpectedType("Unsupported std::any value");
+}
+
+Json JsonValue::toJson() const
+{
+    if (type == Type::Array) {
+        Json result{Json::ArrayType{}};
+        result.reserve(arrayPointer->size());
+        for (const JsonValue &element : *arrayPointer) {
+            result.addToArray(element.toAny());
+        }
+        return result;
+    }
+    if (type == Type::Object) {
+        Json result{Json::ObjectType{}};
+        result.reserve(objectPointer->size());
+        for (const JsonMember &member : *objectPointer) {
+            result.addToObjectKey(std::string(member.key.asString()), member.value.toAny());
+        }
+        return result;
+    }
+    if (type == Type::Null) {
+        return Json{};
+    }
+    throw JsonUnexpectedType("Expected JSON object or array");
+}
+
+JsonValue JsonValue::parse(const std::string &string)
+{
+    return parse(string.data(), string.data() + string.size());
+}
+
+JsonValue JsonValue::parse(const char *begin, const char *end)
+{
+    JsonValueBuilder builder;
+    JsonReader<JsonValueBuilder>{begin, end, builder}.parseRoot();
+    return builder.release();
+}
+
+uint32_t JsonValue::checkedSize(size_t size)
+{
+    if (size > std::numeric_limits<uint32_t>::max()) {
+        throw JsonException("String is too large for JsonValue");
+    }
+    return static_cast<uint32_t>(size);
+}
+
+JsonValue::ArrayType &JsonValue::arrayData()
+{
+    if (type != Type::Array) {
+        throw JsonUnexpectedType("Expected JSON array");
+    }
+    return *arrayPointer;
+}
+
+JsonValue::ObjectType &JsonValue::objectData()
+{
+    if (type != Type::Object) {
+        throw JsonUnexpectedType("Expected JSON object");
+    }
+    return *objectPointer;
+}
+
+void JsonValue::destroy()
+{
+    switch (type) {
+        case Type::String:
+            delete[] string;
+            break;
+        case Type::Array:
+            delete arrayPointer;
+            break;
+        case Type::Object:
+            delete objectPointer;
+            break;
+        default:
+            break;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,136 @@
+#include <cstdint>
+#include <iterator>
+#include "JsonObject.hpp"
+#include "JsonValueBuilder.hpp"
+
+void JsonValueBuilder::startObject()
+{
+    frames.push_back(values.size());
+}
+
+void JsonValueBuilder::key(std::string_view key)
+{
+    // Ключи и значения объекта лежат на стеке через одного, дубликаты проверяются при закрытии
+    values.push_back(makeKey(key));
+}
+
+void JsonValueBuilder::endObject()
+{
+    size_t start = frames.back();
+    frames.pop_back();
+
+    JsonValue object = makeContainer(JsonValue::Type::Object, (values.size() - start) / 2);
+    for (size_t i = start; i < values.size(); i += 2) {
+        auto [slot, added] = object.objectPointer->tryEmplace(std::move(values[i]));
+        if (!added) {
+            throw JsonParseDuplicatedKeyError{"Duplicated key '" + std::string(values[i].asString()) + "'"};
+        }
+        *slot = std::move(values[i + 1]);
+    }
+    values.resize(start);
+    values.push_back(std::move(object));
+}
+
+void JsonValueBuilder::startArray()
+{
+    frames.push_back(values.size());
+}
+
+void JsonValueBuilder::endArray()
+{
+    size_t start = frames.back();
+    frames.pop_back();
+
+    JsonValue array = makeContainer(JsonValue::Type::Array, values.size() - start);
+    std::move(values.begin() + start, values.end(), std::back_inserter(*array.arrayPointer));
+    values.resize(start);
+    values.push_back(std::move(array));
+}
+
+void JsonValueBuilder::string(std::string_view value)
+{
+    values.push_back(makeString(value));
+}
+
+void JsonValueBuilder::number(double value)
+{
+    values.emplace_back(value);
+}
+
+void JsonValueBuilder::integer(int64_t value)
+{
+    values.emplace_back(value);
+}
+
+void JsonValueBuilder::unsignedInteger(uint64_t value)
+{
+    values.emplace_back(value);
+}
+
+void JsonValueBuilder::boolean(bool value)
+{
+    values.emplace_back(value);
+}
+
+void JsonValueBuilder::null()
+{
+    values.emplace_back();
+}
+
+JsonValue JsonValueBuilder::release()
+{
+    JsonValue result = std::move(values.back());
+    values.pop_back();
+    return result;
+}
+
+JsonValue JsonValueBuilder::makeString(std::string_view value)
+{
+    if (!arena) {
+        return JsonValue(value);
+    }
+
+    JsonValue result{JsonValue::Type::String, 0};
+    result.size = JsonValue::checkedSize(value.size());
+
+    // Строка без экранирования - это срез входного буфера, escape-последовательности декодируются в отдельный буфер
+    auto address = reinterpret_cast<uintptr_t>(value.data());
+    auto pinnedAddress = reinterpret_cast<uintptr_t>(pinned.data());
+    if (address >= pinnedAddress && address + value.size() <= pinnedAddress + pinned.size()) {
+        result.string = value.data();
+    } else {
+        result.string = arena->copy(value).data();
+    }
+    return result;
+}
+
+JsonValue JsonValueBuilder::makeKey(std::string_view key)
+{
+    if (!keys || !arena) {
+        return makeString(key);
+    }
+
+    std::string_view interned = keys->intern(key);
+    JsonValue result{JsonValue::Type::String, JsonValue::INTERNED};
+    result.size = JsonValue::checkedSize(interned.size());
+    result.string = interned.data();
+    return result;
+}
+
+JsonValue JsonValueBuilder::makeContainer(JsonValue::Type type, size_t count)
+{
+    if (!arena) {
+        JsonValue result = type == JsonValue::Type::Array ? JsonValue::array() : JsonValue::object();
+        result.reserve(count);
+        return result;
+    }
+
+    JsonValue result{type, 0};
+    if (type == JsonValue::Type::Array) {
+        result.arrayPointer = arena->create<JsonValue::ArrayType>(arena);
+    } else {
+        result.objectPointer = arena->create<JsonValue::ObjectType>(arena);
+    }
+    result.reserve(count);
+    return result;
+}
\ No newline at end of file
@@ -0,0 +1,230 @@
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+
+#include "JsonFormat.hpp"
+#include "JsonWriter.hpp"
+
+namespace
+{
+
+// Проверка вложенности только в отладочной сборке
+void check([[maybe_unused]] bool condition, [[maybe_unused]] const char *message)
+{
+#ifndef NDEBUG
+    if (!condition) {
+        throw JsonWriteException(message);
+    }
+#endif
+}
+
+}
+
+JsonWriter::JsonWriter(std::ostream &outputStream, int indentSize)
+    : stream(&outputStream), indent(indentSize), buffer(new char[BUFFER_SIZE])
+{}
+
+JsonWriter::JsonWriter(int outputDescriptor, int indentSize)
+    : descriptor(outputDescriptor), indent(indentSize), buffer(new char[BUFFER_SIZE])
+{}
+
+JsonWriter::~JsonWriter()
+{
+    try {
+        flush();
+    } catch (const std::exception &) {
+    }
+}
+
+JsonWriter &JsonWriter::beginObject()
+{
+    beginValue();
+    put('{');
+    frames.push_back(Frame{true, true});
+    return *this;
+}
+
+JsonWriter &JsonWriter::endObject()
+{
+    endContainer(true);
+    return *this;
+}
+
+JsonWriter &JsonWriter::beginArray()
+{
+    beginValue();
+    put('[');
+    frames.push_back(Frame{false, true});
+    return *this;
+}
+
+JsonWriter &JsonWriter::endArray()
+{
+    endContainer(false);
+    return *this;
+}
+
+JsonWriter &JsonWriter::key(std::string_view key)
+{
+    check(!frames.empty() && frames.back().object && !afterKey, "Key outside of object");
+
+    Frame &frame = frames.back();
+    if (!frame.empty) {
+        put(',');
+    }
+    frame.empty = false;
+    writeNewLine(frames.size());
+
+    writeQuoted(key);
+    write(indent < 0 ? ":" : ": ");
+
+    afterKey = true;
+    return *this;
+}
+
+JsonWriter &JsonWriter::value(std::string_view value)
+{
+    beginValue();
+    writeQuoted(value);
+    return *this;
+}
+
+JsonWriter &JsonWriter::value(double value)
+{
+    beginValue();
+    writeNumber(value);
+    return *this;
+}
+
+JsonWriter &JsonWriter::value(int64_t value)
+{
+    beginValue();
+    writeNumber(value);
+    return *this;
+}
+
+JsonWriter &JsonWriter::value(uint64_t value)
+{
+    beginValue();
+    writeNumber(value);
+    return *this;
+}
+
+JsonWriter &JsonWriter::value(bool value)
+{
+    beginValue();
+    write(value ? "true" : "false");
+    return *this;
+}
+
+JsonWriter &JsonWriter::value(std::nullptr_t)
+{
+    beginValue();
+    write("null");
+    return *this;
+}
+
+void JsonWriter::flush()
+{
+    size_t count = size;
+    size = 0;
+    writeOut(buffer.get(), count);
+}
+
+void JsonWriter::beginValue()
+{
+    if (frames.empty()) {
+        check(!rootWritten, "Only one root value allowed");
+        rootWritten = true;
+        return;
+    }
+
+    Frame &frame = frames.back();
+    if (frame.object) {
+        check(afterKey, "Value in object without key");
+        afterKey = false;
+        return;
+    }
+
+    if (!frame.empty) {
+        put(',');
+    }
+    frame.empty = false;
+    writeNewLine(frames.size());
+}
+
+void JsonWriter::endContainer(bool object)
+{
+    check(!frames.empty() && frames.back().object == object && !afterKey, "Unbalanced end of container");
+
+    bool empty = frames.back().empty;
+    frames.pop_back();
+    if (!empty) {
+        writeNewLine(frames.size());
+    }
+    put(object ? '}' : ']');
+}
+
+void JsonWriter::writeNewLine(size_t depth)
+{
+    if (indent < 0) {
+        return;
+    }
+
+    put('\n');
+    for (size_t i = 0; i < depth * static_cast<size_t>(indent); i++) {
+        put(' ');
+    }
+}
+
+void JsonWriter::write(std::string_view data)
+{
+    if (data.size() > BUFFER_SIZE - size) {
+        flush();
+        if (data.size() > BUFFER_SIZE) {
+            writeOut(data.data(), data.size());
+            return;
+        }
+    }
+    std::memcpy(buffer.get() + size, data.data(), data.size());
+    size += data.size();
+}
+
+void JsonWriter::writeQuoted(std::string_view string)
+{
+    // Строка, которая может не поместиться в буфер, экранируется отдельно
+    if (JsonFormat::maxQuotedSize(string.size()) > BUFFER_SIZE) {
+        std::string quoted(JsonFormat::quotedSize(string), '\0');
+        JsonFormat::writeQuoted(quoted.data(), string);
+        write(quoted);
+        return;
+    }
+
+    reserve(JsonFormat::maxQuotedSize(string.size()));
+    size = static_cast<size_t>(JsonFormat::writeQuoted(buffer.get() + size, string) - buffer.get());
+}
+
+void JsonWriter::writeOut(const char *data, size_t count)
+{
+    if (stream) {
+        stream->write(data, static_cast<std::streamsize>(count));
+        if (!*stream) {
+            throw JsonWriteException("Cannot write JSON to stream");
+        }
+        return;
+    }
+
+    const char *end = data + count;
+    while (data != end) {
+        ssize_t written = ::write(descriptor, data, static_cast<size_t>(end - data));
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            int error = errno;
+            throw JsonWriteException(std::string("Cannot write JSON: ") + std::strerror(error));
+        }
+        data += written;
+    }
+}
\ No newline at end of file
@@ -1,22 +1,58 @@
-#include <cstring>
-#include <JsonException.hpp>
-#include <boost/algorithm/string.hpp>
-#include <boost/lexical_cast.hpp>
+#include <array>
 #include "Utils.hpp"
 
+namespace
+{
+
+enum CharClass : uint8_t
+{
+    SPACE = 1 << 0,
+    QUOTE = 1 << 1,
+    NUMBER = 1 << 2,
+    SUGAR = 1 << 3,
+};
+
+// Таблица классов символов. Раньше каждый вызов строил предикат boost::is_any_of
+constexpr std::array<uint8_t, 256> makeCharClasses()
+{
+    std::array<uint8_t, 256> classes{};
+    for (char c : {' ', '\t', '\r', '\n'}) {
+        classes[static_cast<unsigned char>(c)] |= SPACE;
+    }
+    for (char c : {'\'', '"'}) {
+        classes[static_cast<unsigned char>(c)] |= QUOTE;
+    }
+    for (char c : {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '-', '+', 'e', 'E', '.'}) {
+        classes[static_cast<unsigned char>(c)] |= NUMBER;
+    }
+    for (char c : {',', ':', '[', ']', '{', '}'}) {
+        classes[static_cast<unsigned char>(c)] |= SUGAR;
+    }
+    return classes;
+}
+
+constexpr std::array<uint8_t, 256> charClasses = makeCharClasses();
+
+bool hasClass(char c, CharClass charClass)
+{
+    return (charClasses[static_cast<unsigned char>(c)] & charClass) != 0;
+}
+
+}
+
 bool Utils::isCharSpace(char c)
 {
-    return boost::is_any_of(" \t\r\n")(c);
+    return hasClass(c, SPACE);
 }
 
 bool Utils::isCharQuote(char c)
 {
-    return boost::is_any_of("\'\"")(c);
+    return hasClass(c, QUOTE);
 }
 
 bool Utils::isCharNumber(char c)
 {
-    return boost::is_any_of("0123456789-e.")(c);
+    return hasClass(c, NUMBER);
 }
 
 bool Utils::isCharEscaping(char c)
@@ -24,12 +60,7 @@ bool Utils::isCharEscaping(char c)
     return c == '\\';
 }
 
-double Utils::stringToNumber(const std::string &string)
-{
-    return boost::lexical_cast<double>(string);
-}
-
 bool Utils::isCharSugar(char c)
 {
-    return boost::is_any_of(",:[]{}")(c);
+    return hasClass(c, SUGAR);
 }
\ No newline at end of file
@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 
 #include "Json.hpp"
+#include "JsonFile.hpp"
+#include "JsonPointer.hpp"
 
 TEST(Json, NullJson)
 {
@@ -60,6 +62,27 @@ TEST(Json, ParseFileException)
     );
 }
 
+TEST(Json, ParseFileMapped)
+{
+    JsonFile file("../tests/TestData.json");
+    EXPECT_EQ(file.isMapped(), true);
+    EXPECT_EQ(file.view().front(), '{');
+
+    JsonFile moved = std::move(file);
+    EXPECT_EQ(moved.view().front(), '{');
+    EXPECT_EQ(file.view().empty(), true);
+}
+
+TEST(Json, ParseFileNotMapped)
+{
+    // Размер файлов procfs неизвестен заранее, такие файлы читаются через read()
+    JsonFile file("/proc/self/status");
+    EXPECT_EQ(file.isMapped(), false);
+    EXPECT_NE(file.view().find("Name:"), std::string_view::npos);
+
+    EXPECT_THROW(JsonFile("__definitely_not_existing_file__"), JsonParseFileException);
+}
+
 TEST(Json, CopyAssigmentOperator)
 {
     ASSERT_EQ(std::is_copy_assignable_v<Json>, true);
@@ -141,6 +164,97 @@ TEST(Json, MoveAssigmentOperatorSelf)
     EXPECT_EQ(json.is_null(), false);
 }
 
+TEST(Json, CopySharesData)
+{
+    Json json{R"({"key":[1,2], "k": "v"})"};
+    const Json jsonCopy = json;
+    EXPECT_EQ(jsonCopy.dump(), json.dump());
+
+    // Чтение ничего не клонирует: копии по-прежнему ссылаются на одни и те же элементы
+    EXPECT_EQ(&jsonCopy["key"], &std::as_const(json)["key"]);
+    EXPECT_EQ(std::any_cast<Json *>(jsonCopy["key"]), std::any_cast<Json *>(std::as_const(json)["key"]));
+    EXPECT_EQ(JsonPointer("/key/1").find(jsonCopy), JsonPointer("/key/1").find(json));
+
+    // И копия прочитанного экземпляра тоже разделяет данные
+    const Json secondCopy = jsonCopy;
+    EXPECT_EQ(&secondCopy["k"], &jsonCopy["k"]);
+
+    // Изменяемая ссылка делает контейнер собственным
+    EXPECT_NE(&json["key"], &jsonCopy["key"]);
+    EXPECT_EQ(&secondCopy["key"], &jsonCopy["key"]);
+}
+
+TEST(Json, CopyIsolatedFromMutableAccess)
+{
+    Json json{R"({"k":{"x":1}})"};
+    Json jsonCopy = json;
+
+    std::any_cast<Json *>(jsonCopy["k"])->addToObjectKey("y", 2.0);
+    EXPECT_EQ(std::any_cast<Json *>(std::as_const(json)["k"])->getSize(), 1u);
+    EXPECT_EQ(std::any_cast<Json *>(std::as_const(jsonCopy)["k"])->getSize(), 2u);
+
+    // То же через вложенный уровень
+    Json deep{R"({"a":{"b":{"c":1}}})"};
+    Json deepCopy = deep;
+    Json *a = std::any_cast<Json *>(deepCopy["a"]);
+    std::any_cast<Json *>((*a)["b"])->addToObjectKey("d", 2.0);
+    EXPECT_EQ(deep.dump(), R"({"a":{"b":{"c":1}}})");
+    EXPECT_EQ(std::any_cast<Json *>(*JsonPointer("/a/b").find(deepCopy))->getSize(), 2u);
+}
+
+TEST(Json, CopyIsolatedFromEarlierPointer)
+{
+    Json json{R"({"k":{"g":{"x":1}}})"};
+    Json *k = std::any_cast<Json *>(json["k"]);
+    Json *g = std::any_cast<Json *>((*k)["g"]);
+
+    // Указатели взяты до копирования: изменения через них не видны в копии
+    Json jsonCopy = json;
+    k->addToObjectKey("y", 2.0);
+    g->addToObjectKey("z", 3.0);
+    EXPECT_EQ(k->getSize(), 2u);
+    EXPECT_EQ(g->getSize(), 2u);
+    EXPECT_EQ(jsonCopy.dump(), R"({"k":{"g":{"x":1}}})");
+
+    // Как и Json *, добавленный вызывающим
+    Json array{Json::ArrayType{}};
+    Json *added = new Json(Json::ObjectType{});
+    array.addToArray(added);
+    Json arrayCopy = array;
+    added->addToObjectKey("a", 1.0);
+    EXPECT_EQ(array.dump(), R"([{"a":1}])");
+    EXPECT_EQ(arrayCopy.dump(), "[{}]");
+}
+
+TEST(Json, CopyOnWrite)
+{
+    Json json{R"({"key":{"list":[1,2]}, "k": "v"})"};
+    Json jsonCopy = json;
+
+    jsonCopy.addToObjectKey("k", std::string("changed"));
+    Json &nested = *std::any_cast<Json *>(jsonCopy["key"]);
+    std::any_cast<Json *>(nested["list"])->addToArray(3.0);
+
+    EXPECT_EQ(std::any_cast<std::string>(jsonCopy["k"]), "changed");
+    EXPECT_EQ(nested.dump(), R"({"list":[1,2,3]})");
+
+    const Json &original = json;
+    EXPECT_EQ(std::any_cast<std::string>(original["k"]), "v");
+    EXPECT_EQ(std::any_cast<Json *>(original["key"])->dump(), R"({"list":[1,2]})");
+}
+
+TEST(Json, CopyOnWriteOriginal)
+{
+    Json json{R"([[1],[2]])"};
+    Json jsonCopy = json;
+
+    std::any_cast<Json *>(json[0])->addToArray(std::string("x"));
+    json.addToArray(true);
+
+    EXPECT_EQ(json.dump(), R"([[1,"x"],[2],true])");
+    EXPECT_EQ(jsonCopy.dump(), "[[1],[2]]");
+}
+
 TEST(Json, AddToObject)
 {
     Json json{"{}"};
@@ -149,6 +263,41 @@ TEST(Json, AddToObject)
     EXPECT_EQ(std::any_cast<std::string>(json["key"]), "value");
 }
 
+TEST(Json, AddMoved)
+{
+    Json json{Json::ObjectType{}};
+    std::string key = "key";
+    std::string value(100, 'x');
+    const char *data = value.data();
+
+    json.addToObjectKey(std::move(key), std::any(std::move(value)));
+    EXPECT_EQ(std::any_cast<std::string>(&json["key"])->data(), data);
+
+    Json array{Json::ArrayType{}};
+    array.reserve(2);
+    array.addToArray(std::string("a"));
+    array.addToArray(new Json(Json::ObjectType{}));
+    EXPECT_EQ(array.dump(), R"(["a",{}])");
+}
+
+TEST(Json, Emplace)
+{
+    Json json{Json::ObjectType{}};
+    json.reserve(1);
+    std::string &string = json.emplaceToObjectKey<std::string>("key", 3u, 'a');
+    EXPECT_EQ(string, "aaa");
+    EXPECT_EQ(&string, std::any_cast<std::string>(&json["key"]));
+
+    Json array{R"([1])"};
+    EXPECT_EQ(array.emplaceToArray<double>(2.5), 2.5);
+    array.emplaceToArray<Json *>(new Json(Json::ArrayType{}));
+    EXPECT_EQ(array.dump(), "[1,2.5,[]]");
+
+    EXPECT_THROW(array.emplaceToObjectKey<bool>("key", true), JsonUnexpectedType);
+    EXPECT_THROW(json.emplaceToArray<bool>(true), JsonUnexpectedType);
+    EXPECT_THROW(Json{}.reserve(1), JsonUnexpectedType);
+}
+
 TEST(Json, AddToObjectException)
 {
     Json json{"[]"};
@@ -239,4 +388,12 @@ TEST(Json, NoJson)
         Json json{"false"},
         JsonParseException
     );
+}
+
+TEST(Json, EmptyInput)
+{
+    EXPECT_THROW(
+        Json json{"   "},
+        JsonParseUnexpectedEof
+    );
 }
\ No newline at end of file
@@ -234,3 +234,69 @@ TEST(JsonArray, BackslashInString)
 
     EXPECT_EQ(std::any_cast<std::string>(json[0]), "word1 \" word2");
 }
+
+
+TEST(JsonArray, EscapedBackslashBeforeQuote)
+{
+    Json json{R"([ "word\\", "next" ])"};
+    EXPECT_EQ(json.getSize(), 2u);
+
+    EXPECT_EQ(std::any_cast<std::string>(json[0]), "word\\");
+    EXPECT_EQ(std::any_cast<std::string>(json[1]), "next");
+}
+
+TEST(JsonArray, UnexpectedEof)
+{
+    EXPECT_THROW(
+        Json{R"([ 1, 2 )"},
+        JsonParseUnexpectedEof
+    );
+}
+
+TEST(JsonArray, ParseParallel)
+{
+    // Строки со скобками и запятыми не должны сбивать деление на диапазоны
+    std::string input = "[";
+    for (int i = 0; i < 30000; i++) {
+        input += R"({"id": )" + std::to_string(i) + R"(, "text": "a, ]} [{ \" b", "list": [1, [2], {}]},)";
+    }
+    input += R"("last"])";
+
+    Json sequential = Json::parse(input);
+    Json parallel = Json::parseParallel(input, 4);
+    ASSERT_EQ(parallel.getSize(), sequential.getSize());
+    for (int i : {0, 12345, 29999}) {
+        Json &element = *std::any_cast<Json *>(parallel[i]);
+        EXPECT_EQ(std::any_cast<double>(element["id"]), i);
+        EXPECT_EQ(std::any_cast<std::string>(element["text"]), "a, ]} [{ \" b");
+    }
+    EXPECT_EQ(std::any_cast<std::string>(parallel[30000]), "last");
+
+    Json copy = parallel;
+    EXPECT_EQ(copy.getSize(), 30001u);
+}
+
+TEST(JsonArray, ParseParallelErrors)
+{
+    std::string input = "[";
+    for (int i = 0; i < 100000; i++) {
+        input += R"({"id": )" + std::to_string(i) + "},";
+    }
+
+    // Ошибка в середине и в конце сообщается так же, как при последовательном разборе
+    for (std::string bad : {input + R"({"id": 1, "id": 2}, 1])", input + "[1 2], 1]", input + "1"}) {
+        bad[bad.size() / 2] = ' ';
+        try {
+            Json::parse(bad);
+            FAIL() << "Expected exception";
+        } catch (const JsonParseException &sequential) {
+            try {
+                Json::parseParallel(bad, 4);
+                FAIL() << "Expected exception";
+            } catch (const JsonParseException &parallel) {
+                EXPECT_EQ(typeid(parallel), typeid(sequential));
+                EXPECT_STREQ(parallel.what(), sequential.what());
+            }
+        }
+    }
+}
\ No newline at end of file
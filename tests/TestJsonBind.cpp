@@ -0,0 +1,217 @@
+#include <gtest/gtest.h>
+
+#include "JsonBind.hpp"
+
+namespace
+{
+    struct Address
+    {
+        std::string city;
+        std::optional<int> zip;
+    };
+
+    struct Person
+    {
+        std::string name;
+        int age = 0;
+        double score = 0;
+        bool active = false;
+        std::vector<std::string> tags;
+        std::optional<Address> address;
+        std::vector<Address> previous;
+    };
+
+    // Рекурсивная структура
+    struct Node
+    {
+        int64_t value = 0;
+        std::vector<Node> children;
+    };
+
+    struct Another
+    {
+        uint32_t keyhere = 0;
+    };
+
+    struct Map
+    {
+        Another another;
+    };
+
+    // Наибольшая поддерживаемая структура: 64 поля
+#define JSON_WIDE_FIELDS(F) \
+    F(f0) F(f1) F(f2) F(f3) F(f4) F(f5) F(f6) F(f7) F(f8) F(f9) F(f10) F(f11) F(f12) F(f13) F(f14) F(f15) \
+    F(f16) F(f17) F(f18) F(f19) F(f20) F(f21) F(f22) F(f23) F(f24) F(f25) F(f26) F(f27) F(f28) F(f29) \
+    F(f30) F(f31) F(f32) F(f33) F(f34) F(f35) F(f36) F(f37) F(f38) F(f39) F(f40) F(f41) F(f42) F(f43) \
+    F(f44) F(f45) F(f46) F(f47) F(f48) F(f49) F(f50) F(f51) F(f52) F(f53) F(f54) F(f55) F(f56) F(f57) \
+    F(f58) F(f59) F(f60) F(f61) F(f62) F(f63)
+
+    struct Wide
+    {
+#define JSON_WIDE_MEMBER(name) int name = 0;
+        JSON_WIDE_FIELDS(JSON_WIDE_MEMBER)
+#undef JSON_WIDE_MEMBER
+    };
+
+    struct Data
+    {
+        std::vector<uint8_t> key;
+        Map map;
+    };
+}
+
+template <>
+struct JsonBinding<Address>
+{
+    static constexpr auto fields = std::make_tuple(JSON_FIELD(Address, city), JSON_FIELD(Address, zip));
+};
+
+template <>
+struct JsonBinding<Person>
+{
+    static constexpr auto fields = std::make_tuple(
+        JSON_FIELD(Person, name),
+        JsonField{"years", &Person::age},
+        JSON_FIELD(Person, score),
+        JSON_FIELD(Person, active),
+        JSON_FIELD(Person, tags),
+        JSON_FIELD(Person, address),
+        JSON_FIELD(Person, previous)
+    );
+};
+
+template <>
+struct JsonBinding<Node>
+{
+    static constexpr auto fields = std::make_tuple(JSON_FIELD(Node, value), JSON_FIELD(Node, children));
+};
+
+template <>
+struct JsonBinding<Another>
+{
+    static constexpr auto fields = std::make_tuple(JSON_FIELD(Another, keyhere));
+};
+
+template <>
+struct JsonBinding<Map>
+{
+    static constexpr auto fields = std::make_tuple(JSON_FIELD(Map, another));
+};
+
+template <>
+struct JsonBinding<Data>
+{
+    static constexpr auto fields = std::make_tuple(JSON_FIELD(Data, key), JSON_FIELD(Data, map));
+};
+
+template <>
+struct JsonBinding<Wide>
+{
+#define JSON_WIDE_FIELD(name) std::make_tuple(JSON_FIELD(Wide, name)),
+    static constexpr auto fields = std::tuple_cat(JSON_WIDE_FIELDS(JSON_WIDE_FIELD) std::tuple<>());
+#undef JSON_WIDE_FIELD
+};
+
+TEST(JsonBind, Struct)
+{
+    auto person = JsonBind::parse<Person>(R"({
+        "name": "Ann \"A\"", "years": 42, "score": 4.5, "active": true,
+        "unknown": {"deep": [1, {"x": "]}"}, "\"quoted\""]}, "skipped": 1e5,
+        "tags": ["a", "b"], "address": {"city": "Moscow", "zip": null},
+        "previous": [{"city": "Tver", "zip": 170000}, {"city": "Kazan"}]
+    })");
+
+    EXPECT_EQ(person.name, "Ann \"A\"");
+    EXPECT_EQ(person.age, 42);
+    EXPECT_EQ(person.score, 4.5);
+    EXPECT_TRUE(person.active);
+    EXPECT_EQ(person.tags, (std::vector<std::string>{"a", "b"}));
+    ASSERT_TRUE(person.address);
+    EXPECT_EQ(person.address->city, "Moscow");
+    EXPECT_FALSE(person.address->zip);
+    ASSERT_EQ(person.previous.size(), 2u);
+    EXPECT_EQ(person.previous[0].zip, 170000);
+    EXPECT_EQ(person.previous[1].city, "Kazan");
+    EXPECT_FALSE(person.previous[1].zip);
+
+    auto nobody = JsonBind::parse<Person>(R"({"name": "", "years": 1.0, "score": 1, "active": false,
+                                              "tags": [], "address": null, "previous": []})");
+    EXPECT_EQ(nobody.age, 1);
+    EXPECT_FALSE(nobody.address);
+}
+
+TEST(JsonBind, Recursive)
+{
+    auto tree = JsonBind::parse<Node>(R"({"value": 1, "children": [{"value": 2, "children": []},
+                                         {"value": -3, "children": [{"value": 4, "children": []}]}]})");
+    ASSERT_EQ(tree.children.size(), 2u);
+    EXPECT_EQ(tree.children[1].value, -3);
+    EXPECT_EQ(tree.children[1].children[0].value, 4);
+
+    auto nodes = JsonBind::parse<std::vector<Node>>(R"([{"value": 5, "children": []}])");
+    ASSERT_EQ(nodes.size(), 1u);
+    EXPECT_EQ(nodes[0].value, 5);
+}
+
+TEST(JsonBind, Wide)
+{
+    std::string text = "{";
+    for (int i = 63; i >= 0; i--) {
+        text += "\"f" + std::to_string(i) + "\": " + std::to_string(i) + (i ? ", " : "}");
+    }
+    auto wide = JsonBind::parse<Wide>(text);
+    EXPECT_EQ(wide.f0, 0);
+    EXPECT_EQ(wide.f45, 45);
+    EXPECT_EQ(wide.f63, 63);
+
+    EXPECT_THROW(JsonBind::parse<Wide>(R"({"f0": 1})"), JsonBindException);
+}
+
+TEST(JsonBind, File)
+{
+    auto data = JsonBind::parseFile<Data>("../tests/TestData.json");
+    EXPECT_EQ(data.key, (std::vector<uint8_t>{1, 2, 3}));
+    EXPECT_EQ(data.map.another.keyhere, 123u);
+
+    EXPECT_THROW(JsonBind::parseFile<Data>("__definitely_not_existing_file__"), JsonParseFileException);
+}
+
+TEST(JsonBind, Errors)
+{
+    auto message = [](const std::string &text) {
+        try {
+            JsonBind::parse<Person>(text);
+        } catch (const JsonBindException &exception) {
+            return std::string(exception.what());
+        }
+        return std::string();
+    };
+
+    std::string valid = R"("name": "n", "years": 1, "score": 1, "active": true, "tags": [], "previous": [)";
+    EXPECT_EQ(message("{" + valid + "]}"), "");
+    EXPECT_EQ(message(R"({"name": "n"})"), "Missing field 'years'");
+    EXPECT_EQ(message("{" + valid + R"({"city": "c"}, {"zip": 1}]})"), "Missing field 'city' at 'previous[1]'");
+    EXPECT_EQ(message("{" + valid + R"({"city": 1}]})"), "Expected string, got number at 'previous[0].city'");
+    EXPECT_EQ(message(R"({"name": null})"), "Expected string, got null at 'name'");
+    EXPECT_EQ(message(R"({"name": "n", "years": 1.5})"), "Expected integer, got number at 'years'");
+    EXPECT_EQ(message(R"({"name": "n", "years": 3000000000})"), "Expected integer, got number at 'years'");
+    EXPECT_EQ(message(R"({"name": "n", "years": 1, "tags": {}})"), "Expected array, got object at 'tags'");
+    EXPECT_EQ(message(R"({"name": "n", "years": 1, "tags": ["a", false]})"), "Expected string, got boolean at 'tags[1]'");
+    EXPECT_EQ(message("[]"), "Expected object, got array");
+
+    using Strings = std::vector<std::optional<std::string>>;
+    EXPECT_EQ(JsonBind::parse<Strings>(R"(["a", null])").size(), 2u);
+    EXPECT_THROW(JsonBind::parse<Strings>(R"(["a", null, 1])"), JsonBindException);
+
+    EXPECT_THROW(JsonBind::parse<Person>(R"({"name": "a", "name": "b"})"), JsonParseDuplicatedKeyError);
+    EXPECT_THROW(JsonBind::parse<Person>(R"({"name": "a", "unknown": [1, 2)"), JsonParseUnexpectedEof);
+    EXPECT_THROW(JsonBind::parse<Person>(R"({"name": "a",)"), JsonParseException);
+
+    // Пропускаемые значения проверяются так же строго
+    for (const char *text : {R"({"name":"a","u":[1}})", R"({"name":"a","u":tru})", R"({"name":"a","u":{]})",
+                             R"({"name":"a","u":[1 2]})", R"({"name":"a","u":{"k" 1}})", R"({"name":"a","u":{1:2}})",
+                             R"({"name":"a","u":[01]})", R"({"name":"a","u":[1,]})", R"({"name":"a","u":"\x"})",
+                             R"({"name":"a","u":nullx})"}) {
+        EXPECT_THROW(JsonBind::parse<Person>(text), JsonParseException) << text;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+
+#include "JsonCbor.hpp"
+
+namespace
+{
+    std::string bytes(std::initializer_list<int> values)
+    {
+        std::string result;
+        for (int value : values) {
+            result.push_back(static_cast<char>(value));
+        }
+        return result;
+    }
+}
+
+TEST(JsonCbor, Encode)
+{
+    Json json{R"([1, -1, 100000, 1.5, 0.1, "a", true, null, {}, []])"};
+
+    std::string expected = bytes({0x8a, 0x01, 0x20, 0x1a, 0x00, 0x01, 0x86, 0xa0, 0xfa, 0x3f, 0xc0, 0x00, 0x00,
+                                  0xfb, 0x3f, 0xb9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9a, 0x61, 'a', 0xf5, 0xf6,
+                                  0xa0, 0x80});
+    EXPECT_EQ(JsonCbor::encode(json), expected);
+    EXPECT_EQ(JsonCbor::encode(Json{}), bytes({0xf6}));
+}
+
+TEST(JsonCbor, RoundTrip)
+{
+    Json json{R"([{"key": [[1, 2], {"nested": "value"}]}, -0.0, 1e300, -123456789012, 18446744073709551615,
+                  "строка \" с кавычкой", false, null, 3.14159])"};
+
+    std::string encoded = JsonCbor::encode(json);
+    Json decoded = JsonCbor::decode(encoded);
+    EXPECT_EQ(decoded.dump(), json.dump());
+    EXPECT_TRUE(std::signbit(std::any_cast<double>(decoded[1])));
+
+    Json empty = JsonCbor::decode(JsonCbor::encode(Json{}));
+    EXPECT_TRUE(empty.is_null());
+
+    auto data = Json::parseFile("../tests/TestData.json");
+    Json object = JsonCbor::decode(JsonCbor::encode(data));
+    EXPECT_EQ(object.getKeys().size(), data.getKeys().size());
+    EXPECT_EQ(JsonCbor::encode(object).size(), JsonCbor::encode(data).size());
+}
+
+TEST(JsonCbor, PreciseIntegers)
+{
+    // Больше 2^53: через double значения потеряли бы младшие разряды
+    Json json = Json::parse("[9007199254740993, -9223372036854775808, 18446744073709551615, 1.5]", true);
+
+    Json decoded = JsonCbor::decode(JsonCbor::encode(json), true);
+    EXPECT_EQ(std::any_cast<int64_t>(decoded[0]), 9007199254740993);
+    EXPECT_EQ(std::any_cast<int64_t>(decoded[1]), INT64_MIN);
+    EXPECT_EQ(std::any_cast<uint64_t>(decoded[2]), UINT64_MAX);
+    EXPECT_EQ(std::any_cast<double>(decoded[3]), 1.5);
+    EXPECT_EQ(decoded.dump(), json.dump());
+
+    // По умолчанию, как и при разборе текста, все числа - double
+    Json rounded = JsonCbor::decode(JsonCbor::encode(json));
+    EXPECT_EQ(std::any_cast<double>(rounded[0]), 9007199254740992.);
+
+    // Целое значение double пишется как целое, если не задан exactNumbers
+    Json whole = Json::parse("[3.0]", true);
+    EXPECT_EQ(JsonCbor::decode(JsonCbor::encode(whole), true)[0].type(), typeid(int64_t));
+    EXPECT_EQ(std::any_cast<double>(JsonCbor::decode(JsonCbor::encode(whole, true), true)[0]), 3.0);
+}
+
+TEST(JsonCbor, Decode)
+{
+    // Половинная точность, тег, максимальные целые
+    Json json = JsonCbor::decode(bytes({0x85, 0xf9, 0x3c, 0x00, 0xc1, 0x1a, 0x51, 0x4b, 0x67, 0xb0,
+                                        0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+                                        0x3b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7}));
+    EXPECT_EQ(std::any_cast<double>(json[0]), 1.0);
+    EXPECT_EQ(std::any_cast<double>(json[1]), 1363896240.0);
+    EXPECT_EQ(std::any_cast<double>(json[2]), 18446744073709551615.0);
+    EXPECT_EQ(std::any_cast<double>(json[3]), -18446744073709551616.0);
+    EXPECT_FALSE(json[4].has_value());
+
+    Json object = JsonCbor::decode(bytes({0xa1, 0x61, 'k', 0x82, 0xf4, 0x38, 0x63}));
+    EXPECT_EQ(object.dump(), R"({"k":[false,-100]})");
+}
+
+TEST(JsonCbor, DecodeErrors)
+{
+    EXPECT_THROW(JsonCbor::decode(""), JsonParseUnexpectedEof);
+    EXPECT_THROW(JsonCbor::decode(bytes({0x82, 0x01})), JsonParseUnexpectedEof);
+    EXPECT_THROW(JsonCbor::decode(bytes({0x81, 0x63, 'a'})), JsonParseUnexpectedEof);
+    EXPECT_THROW(JsonCbor::decode(bytes({0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff})),
+                 JsonParseUnexpectedEof);
+
+    EXPECT_THROW(JsonCbor::decode(bytes({0x01})), JsonParseUnexpectedChar);
+    EXPECT_THROW(JsonCbor::decode(bytes({0x80, 0x80})), JsonParseUnexpectedChar);
+    EXPECT_THROW(JsonCbor::decode(bytes({0x9f, 0x01, 0xff})), JsonParseUnexpectedChar);
+    EXPECT_THROW(JsonCbor::decode(bytes({0x81, 0x41, 0x00})), JsonParseUnexpectedChar);
+    EXPECT_THROW(JsonCbor::decode(bytes({0xa1, 0x01, 0x01})), JsonParseUnexpectedChar);
+    EXPECT_THROW(JsonCbor::decode(bytes({0xa2, 0x61, 'k', 0x01, 0x61, 'k', 0x02})), JsonParseDuplicatedKeyError);
+}
+
+TEST(JsonCbor, DecodeFile)
+{
+    Json json{R"({"list": [1, 2, 3], "name": "file"})"};
+    const char *path = "__cbor_test__.bin";
+    {
+        std::ofstream file(path, std::ios::binary);
+        file << JsonCbor::encode(json);
+    }
+
+    Json decoded = JsonCbor::decodeFile(path);
+    std::remove(path);
+    EXPECT_EQ(std::any_cast<std::string>(decoded["name"]), "file");
+    EXPECT_EQ(std::any_cast<Json *>(decoded["list"])->getSize(), 3u);
+
+    EXPECT_THROW(JsonCbor::decodeFile("__definitely_not_existing_file__"), JsonParseFileException);
+}
\ No newline at end of file
@@ -0,0 +1,221 @@
+#include <gtest/gtest.h>
+
+#include "JsonDocument.hpp"
+
+TEST(JsonDocument, ExampleDocument)
+{
+    auto document = JsonDocument::parse(R"(
+        {
+            "lastname" : "Ivanov",
+            "age" : 25,
+            "islegal" : false,
+            "marks" : [4, 5.5, null],
+            "address" : { "city" : "Moscow" }
+        }
+    )");
+
+    const auto &root = document.root();
+    EXPECT_EQ(root.is_object(), true);
+    EXPECT_EQ(root.getSize(), 5u);
+
+    EXPECT_EQ(root["lastname"].asString(), "Ivanov");
+    EXPECT_EQ(root["age"].asInteger(), 25);
+    EXPECT_EQ(root["age"].asNumber(), 25.);
+    EXPECT_EQ(root["islegal"].asBool(), false);
+
+    const auto &marks = root["marks"];
+    EXPECT_EQ(marks.is_array(), true);
+    EXPECT_EQ(marks.getSize(), 3u);
+    EXPECT_EQ(marks[0].asInteger(), 4);
+    EXPECT_EQ(marks[1].asNumber(), 5.5);
+    EXPECT_EQ(marks[2].is_null(), true);
+
+    EXPECT_EQ(root["address"]["city"].asString(), "Moscow");
+
+    std::vector<std::string_view> keys = {"lastname", "age", "islegal", "marks", "address"};
+    EXPECT_EQ(root.getKeys(), keys);
+}
+
+TEST(JsonDocument, Exceptions)
+{
+    auto document = JsonDocument::parse(R"({"a": [1], "s": "x"})");
+    const auto &root = document.root();
+
+    EXPECT_THROW(root[0], JsonUnexpectedType);
+    EXPECT_THROW(root["missing"], JsonUnexpectedKey);
+    EXPECT_THROW(root["a"][1], JsonUnexpectedKey);
+    EXPECT_THROW(static_cast<void>(root["s"].asNumber()), JsonUnexpectedType);
+    EXPECT_THROW(static_cast<void>(root["a"].asString()), JsonUnexpectedType);
+
+    EXPECT_THROW(JsonDocument::parse(R"({"a": 1, "a": 2})"), JsonParseDuplicatedKeyError);
+    EXPECT_THROW(JsonDocument::parse(R"([1, )"), JsonParseUnexpectedEof);
+}
+
+TEST(JsonDocument, OutlivesInput)
+{
+    auto input = std::make_unique<std::string>(R"(["first", {"key": "second"}])");
+    auto document = JsonDocument::parse(*input);
+    input.reset();
+
+    auto moved = std::move(document);
+    EXPECT_EQ(moved.root()[0].asString(), "first");
+    EXPECT_EQ(moved.root()[1]["key"].asString(), "second");
+}
+
+TEST(JsonDocument, LargeDocumentInArena)
+{
+    std::string input = "[";
+    for (int i = 0; i < 100000; i++) {
+        input += R"({"id": )" + std::to_string(i) + R"(, "name": "item"},)";
+    }
+    input.back() = ']';
+
+    auto document = JsonDocument::parse(input);
+    EXPECT_EQ(document.root().getSize(), 100000u);
+    EXPECT_EQ(document.root()[99999]["id"].asInteger(), 99999);
+    EXPECT_GT(document.getMemoryUsage(), 0u);
+}
+
+TEST(JsonDocument, ParseInPlace)
+{
+    std::string input = R"({"name": "Ivanov", "escaped": "line\nbreak", "list": ["a", "b"]})";
+    auto copied = JsonDocument::parse(input);
+    auto document = JsonDocument::parseInPlace(std::move(input));
+
+    // Строки без экранирования указывают во входной буфер документа
+    auto isPinned = [&document](std::string_view string) {
+        std::string_view buffer = document.getInput();
+        return string.data() >= buffer.data() && string.data() + string.size() <= buffer.data() + buffer.size();
+    };
+    const auto &root = document.root();
+    EXPECT_EQ(root["name"].asString(), "Ivanov");
+    EXPECT_TRUE(isPinned(root["name"].asString()));
+    EXPECT_TRUE(isPinned(root.getKeys()[0]));
+    EXPECT_EQ(root["list"][1].asString(), "b");
+    EXPECT_TRUE(isPinned(root["list"][1].asString()));
+    EXPECT_EQ(root["escaped"].asString(), "line\nbreak");
+    EXPECT_FALSE(isPinned(root["escaped"].asString()));
+
+    EXPECT_TRUE(copied.getInput().empty());
+
+    // Короткая строка без выделения памяти тоже переносится корректно
+    auto small = JsonDocument::parseInPlace(std::string(R"(["x"])"));
+    auto moved = std::move(small);
+    EXPECT_EQ(moved.root()[0].asString(), "x");
+}
+
+TEST(JsonDocument, ParseInPlaceMemory)
+{
+    std::string input = "[";
+    for (int i = 0; i < 10000; i++) {
+        input += "\"" + std::string(100, 'a' + i % 26) + "\",";
+    }
+    input.back() = ']';
+
+    auto copied = JsonDocument::parse(input);
+    auto document = JsonDocument::parseInPlace(std::move(input));
+    EXPECT_EQ(document.root()[9999].asString(), copied.root()[9999].asString());
+    EXPECT_LT(document.getMemoryUsage() * 2, copied.getMemoryUsage());
+}
+
+TEST(JsonDocument, ParseInPlaceShared)
+{
+    auto input = std::make_shared<const std::string>(R"({"key": "value"})");
+    auto document = JsonDocument::parseInPlace(input);
+    input.reset();
+
+    EXPECT_EQ(document.root()["key"].asString(), "value");
+    EXPECT_EQ(document.getInput(), R"({"key": "value"})");
+}
+
+TEST(JsonDocument, ParseFile)
+{
+    auto document = JsonDocument::parseFile("../tests/TestData.json");
+    EXPECT_EQ(document.root().getSize(), 2u);
+    EXPECT_EQ(document.getInput().front(), '{');
+
+    EXPECT_THROW(JsonDocument::parseFile("__definitely_not_existing_file__"), JsonParseFileException);
+}
+
+TEST(JsonDocument, MovedFrom)
+{
+    auto document = JsonDocument::parseInPlace(std::string(R"({"key": "value"})"));
+    size_t memory = document.getMemoryUsage();
+
+    JsonDocument moved = std::move(document);
+    EXPECT_EQ(moved.getMemoryUsage(), memory);
+    EXPECT_EQ(moved.root()["key"].asString(), "value");
+
+    // Перемещенный документ пуст, но им можно пользоваться
+    EXPECT_EQ(document.getMemoryUsage(), 0u);
+    EXPECT_TRUE(document.getInput().empty());
+    EXPECT_TRUE(document.root().is_null());
+
+    document = std::move(moved);
+    EXPECT_EQ(document.root()["key"].asString(), "value");
+    EXPECT_EQ(moved.getMemoryUsage(), 0u);
+}
+
+TEST(JsonDocument, KeyPool)
+{
+    std::string input = "[";
+    for (int i = 0; i < 10000; i++) {
+        input += R"({"identifier": )" + std::to_string(i) + R"(, "description": "item"},)";
+    }
+    input.back() = ']';
+
+    auto pool = std::make_shared<JsonKeyPool>();
+    auto first = JsonDocument::parse(input, pool);
+    auto second = JsonDocument::parse(R"({"identifier": 1, "other": 2})", pool);
+    EXPECT_EQ(pool->getSize(), 3u);
+
+    // Одинаковые ключи во всех объектах и документах указывают в пул
+    std::string_view key = first.root()[0].getKeys()[0];
+    EXPECT_EQ(first.root()[9999].getKeys()[0].data(), key.data());
+    EXPECT_EQ(second.root().getKeys()[0].data(), key.data());
+    EXPECT_EQ(first.root()[9999]["identifier"].asInteger(), 9999);
+
+    // Документ удерживает пул
+    pool.reset();
+    EXPECT_EQ(second.root()["other"].asInteger(), 2);
+}
+
+TEST(JsonDocument, KeyPoolLargeObject)
+{
+    // Индекс большого объекта строится по хешам из пула
+    std::string input = "{";
+    for (int i = 0; i < 100; i++) {
+        input += "\"key" + std::to_string(i) + "\": " + std::to_string(i) + ",";
+    }
+    input.back() = '}';
+
+    auto pool = std::make_shared<JsonKeyPool>(false);
+    auto document = JsonDocument::parseInPlace(std::string(input), pool);
+    EXPECT_EQ(document.root()["key42"].asInteger(), 42);
+    EXPECT_EQ(document.root()["key99"].asInteger(), 99);
+    EXPECT_THROW(document.root()["key100"], JsonUnexpectedKey);
+
+    input.back() = ',';
+    input += R"("key7": 0})";
+    EXPECT_THROW(JsonDocument::parse(input, pool), JsonParseDuplicatedKeyError);
+}
+
+TEST(JsonArena, Allocation)
+{
+    JsonArena arena{64};
+
+    auto first = static_cast<char *>(arena.allocate(10, 1));
+    auto second = arena.allocateArray<double>(3);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(second) % alignof(double), 0u);
+    EXPECT_NE(static_cast<void *>(first), static_cast<void *>(second));
+
+    // Большой запрос получает отдельный блок
+    auto big = arena.allocate(1000);
+    EXPECT_NE(big, nullptr);
+    EXPECT_GE(arena.getReservedSize(), 1000u);
+
+    EXPECT_EQ(arena.copy("text"), "text");
+
+    arena.release();
+    EXPECT_EQ(arena.getReservedSize(), 0u);
+}
\ No newline at end of file
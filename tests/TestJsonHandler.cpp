@@ -0,0 +1,186 @@
+#include <gtest/gtest.h>
+
+#include "Json.hpp"
+#include "JsonDomBuilder.hpp"
+#include "JsonIncrementalParser.hpp"
+#include "JsonParser.hpp"
+#include "JsonReader.hpp"
+
+// Записывает события в строку, чтобы проверять их порядок
+class RecordingHandler : public JsonHandler
+{
+public:
+    void startObject() override
+    {
+        events += "{";
+    }
+
+    void key(std::string_view key) override
+    {
+        events += "k:" + std::string(key) + " ";
+    }
+
+    void endObject() override
+    {
+        events += "}";
+    }
+
+    void startArray() override
+    {
+        events += "[";
+    }
+
+    void endArray() override
+    {
+        events += "]";
+    }
+
+    void string(std::string_view value) override
+    {
+        events += "s:" + std::string(value) + " ";
+    }
+
+    void number(double value) override
+    {
+        events += "n:" + std::to_string(static_cast<int>(value)) + " ";
+    }
+
+    void boolean(bool value) override
+    {
+        events += value ? "true " : "false ";
+    }
+
+    void null() override
+    {
+        events += "null ";
+    }
+
+    std::string events;
+};
+
+TEST(JsonHandler, EventsOrder)
+{
+    RecordingHandler handler;
+    JsonParser::parse(R"({"a": [1, "x\ty", true, null], "b": {}})", handler);
+
+    EXPECT_EQ(handler.events, "{k:a [n:1 s:x\ty true null ]k:b {}}");
+}
+
+TEST(JsonHandler, DuplicatedKeysAreNotChecked)
+{
+    RecordingHandler handler;
+    JsonParser::parse(R"({"a": 1, "a": 2})", handler);
+
+    EXPECT_EQ(handler.events, "{k:a n:1 k:a n:2 }");
+}
+
+TEST(JsonHandler, ParseError)
+{
+    RecordingHandler handler;
+
+    EXPECT_THROW(
+        JsonParser::parse(R"([1, 2)", handler),
+        JsonParseUnexpectedEof
+    );
+    EXPECT_EQ(handler.events, "[n:1 n:2 ");
+}
+
+TEST(JsonHandler, ArrayElementByElement)
+{
+    std::string input = R"([[1, "a"], {"skipped": "]"}, [], true] )";
+    RecordingHandler handler;
+    JsonReader<RecordingHandler> reader{input.data(), input.data() + input.size(), handler};
+
+    reader.enterArray();
+    ASSERT_TRUE(reader.nextElement());
+    reader.enterArray();
+    while (reader.nextElement()) {
+        reader.parseValue();
+    }
+    ASSERT_TRUE(reader.nextElement());
+    reader.skipValue();
+    ASSERT_TRUE(reader.nextElement());
+    reader.enterArray();
+    EXPECT_FALSE(reader.nextElement());
+    ASSERT_TRUE(reader.nextElement());
+    reader.parseValue();
+    EXPECT_FALSE(reader.nextElement());
+    reader.parseEnd();
+    EXPECT_EQ(handler.events, "n:1 s:a true ");
+
+    auto walk = [&handler](const std::string &text) {
+        JsonReader<RecordingHandler> arrayReader{text.data(), text.data() + text.size(), handler};
+        arrayReader.enterArray();
+        while (arrayReader.nextElement()) {
+            arrayReader.parseValue();
+        }
+    };
+    EXPECT_THROW(walk("{}"), JsonParseUnexpectedChar);
+    EXPECT_THROW(walk("[1 2]"), JsonParseUnexpectedChar);
+    EXPECT_THROW(walk("[1,]"), JsonParseUnexpectedChar);
+    EXPECT_THROW(walk("[1,"), JsonParseUnexpectedEof);
+}
+
+TEST(JsonHandler, IncrementalAnySplit)
+{
+    std::string input = R"( {"key": [12.5e1, -7, "a\"bé", true, false, null, {}], "x": 'y'} )";
+
+    RecordingHandler expected;
+    JsonParser::parse(input, expected);
+
+    // Документ делится на две части во всех возможных местах
+    for (size_t split = 0; split <= input.size(); split++) {
+        RecordingHandler handler;
+        JsonIncrementalParser parser{handler};
+        parser.feed(input.data(), split);
+        parser.feed(input.data() + split, input.size() - split);
+        parser.finish();
+        EXPECT_EQ(handler.events, expected.events) << "split at " << split;
+    }
+
+    // И по одному символу
+    RecordingHandler handler;
+    JsonIncrementalParser parser{handler};
+    for (char c : input) {
+        parser.feed(&c, 1);
+    }
+    parser.finish();
+    EXPECT_EQ(handler.events, expected.events);
+}
+
+TEST(JsonHandler, IncrementalBuildsJson)
+{
+    JsonDomBuilder builder;
+    JsonIncrementalParser parser{builder};
+    parser.feed(R"({"lastname": "Iva)");
+    parser.feed(R"(nov", "marks": [4, 5)");
+    parser.feed("]}");
+    parser.finish();
+
+    std::unique_ptr<Json> json{builder.release()};
+    EXPECT_EQ(std::any_cast<std::string>((*json)["lastname"]), "Ivanov");
+    EXPECT_EQ(std::any_cast<double>((*std::any_cast<Json *>((*json)["marks"]))[1]), 5);
+}
+
+TEST(JsonHandler, IncrementalErrors)
+{
+    auto parse = [](std::initializer_list<std::string_view> parts) {
+        RecordingHandler handler;
+        JsonIncrementalParser parser{handler};
+        for (std::string_view part : parts) {
+            parser.feed(part);
+        }
+        parser.finish();
+    };
+
+    EXPECT_THROW(parse({""}), JsonParseUnexpectedEof);
+    EXPECT_THROW(parse({"[1, 2"}), JsonParseUnexpectedEof);
+    EXPECT_THROW(parse({"[\"abc", "def"}), JsonParseUnexpectedEof);
+    EXPECT_THROW(parse({"1"}), JsonParseUnexpectedChar);
+    EXPECT_THROW(parse({"[1 2]"}), JsonParseUnexpectedChar);
+    EXPECT_THROW(parse({"[tr", "ue, tr", "ee]"}), JsonParseUnexpectedChar);
+    EXPECT_THROW(parse({"[1.", "2.3]"}), JsonParseCannotParseNumber);
+    EXPECT_THROW(parse({"{1: 2}"}), JsonParseUnexpectedChar);
+    EXPECT_THROW(parse({"[]", " []"}), JsonParseUnexpectedChar);
+    EXPECT_THROW(parse({R"(["\x"])"}), JsonParseInvalidEscape);
+}
\ No newline at end of file
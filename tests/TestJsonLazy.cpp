@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+#include <thread>
+
+#include "Json.hpp"
+#include "JsonLazy.hpp"
+
+TEST(JsonLazy, ExampleDocument)
+{
+    auto document = JsonLazyDocument::parse(R"(
+        {
+            "lastname" : "Ivanov",
+            "age" : 25,
+            "islegal" : false,
+            "marks" : [4, 5.5, null],
+            "address" : { "city" : "Moscow" }
+        }
+    )");
+
+    const auto &root = document.root();
+    EXPECT_EQ(root.is_object(), true);
+    EXPECT_EQ(root.getSize(), 5u);
+    EXPECT_EQ(root["lastname"].asString(), "Ivanov");
+    EXPECT_EQ(root["age"].asInteger(), 25);
+    EXPECT_EQ(root["islegal"].asBool(), false);
+    EXPECT_EQ(root["marks"].getSize(), 3u);
+    EXPECT_EQ(root["marks"][1].asNumber(), 5.5);
+    EXPECT_EQ(root["marks"][2].is_null(), true);
+    EXPECT_EQ(root["address"]["city"].asString(), "Moscow");
+
+    std::vector<std::string_view> keys = {"lastname", "age", "islegal", "marks", "address"};
+    EXPECT_EQ(root.getKeys(), keys);
+
+    JsonValue value = root.toValue();
+    EXPECT_EQ(value["marks"][0].asInteger(), 4);
+    EXPECT_EQ(value["address"]["city"].asString(), "Moscow");
+}
+
+TEST(JsonLazy, SkippedSubtreesAreNotParsed)
+{
+    // Ошибка во вложенном контейнере видна только при обращении к нему
+    auto document = JsonLazyDocument::parse(R"({"good": [1, 2], "bad": {"a": tru, "a": 1}})");
+    const auto &root = document.root();
+
+    EXPECT_EQ(root["good"][1].asInteger(), 2);
+    EXPECT_THROW(static_cast<void>(root["bad"].getSize()), JsonParseUnexpectedChar);
+}
+
+TEST(JsonLazy, StructuralErrors)
+{
+    EXPECT_THROW(JsonLazyDocument::parse(""), JsonParseUnexpectedEof);
+    EXPECT_THROW(JsonLazyDocument::parse("1"), JsonParseUnexpectedChar);
+    EXPECT_THROW(JsonLazyDocument::parse("[1, {]"), JsonParseUnexpectedChar);
+    EXPECT_THROW(JsonLazyDocument::parse("[1, [2]"), JsonParseUnexpectedEof);
+    EXPECT_THROW(JsonLazyDocument::parse(R"(["abc)"), JsonParseUnexpectedEof);
+    EXPECT_THROW(JsonLazyDocument::parse("[] []"), JsonParseUnexpectedChar);
+
+    // Текст сразу за закрывающей кавычкой - те же ошибки, что у Json::parse
+    for (std::string text : {R"(["a"x])", R"({"a"x:1})", R"(["a"1])"}) {
+        std::string expected;
+        try {
+            static_cast<void>(Json::parse(text));
+        } catch (const JsonParseUnexpectedChar &exception) {
+            expected = exception.what();
+        }
+        try {
+            JsonLazyDocument::parse(std::move(text));
+            ADD_FAILURE() << "Expected JsonParseUnexpectedChar";
+        } catch (const JsonParseUnexpectedChar &exception) {
+            EXPECT_EQ(exception.what(), expected);
+        }
+    }
+
+    auto check = [](std::string text, auto exception) {
+        auto document = JsonLazyDocument::parse(std::move(text));
+        EXPECT_THROW(static_cast<void>(document.root().toValue()), decltype(exception));
+    };
+    check("[1 2]", JsonParseUnexpectedChar{""});
+    check("[1, ]", JsonParseUnexpectedChar{""});
+    check(R"({"a" 1})", JsonParseUnexpectedChar{""});
+    check(R"({"a": 1, "a": 2})", JsonParseDuplicatedKeyError{""});
+    check("[01]", JsonParseCannotParseNumber{""});
+}
+
+TEST(JsonLazy, ConcurrentReaders)
+{
+    std::string input = "[";
+    for (int i = 0; i < 1000; i++) {
+        input += R"({"id": )" + std::to_string(i) + R"(, "tags": ["a", "b"]},)";
+    }
+    input.back() = ']';
+    auto document = JsonLazyDocument::parse(std::move(input));
+
+    std::vector<std::thread> threads;
+    std::vector<int64_t> sums(4);
+    for (size_t t = 0; t < sums.size(); t++) {
+        threads.emplace_back([&document, &sums, t]() {
+            for (size_t i = 0; i < document.root().getSize(); i++) {
+                sums[t] += document.root()[i]["id"].asInteger();
+                EXPECT_EQ(document.root()[i]["tags"][1].asString(), "b");
+            }
+        });
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+
+    for (int64_t sum : sums) {
+        EXPECT_EQ(sum, 999 * 1000 / 2);
+    }
+}
\ No newline at end of file
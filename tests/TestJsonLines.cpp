@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+#include <mutex>
+
+#include "JsonLines.hpp"
+
+namespace
+{
+    // Много записей, чтобы вход разбился на несколько кусков
+    std::string makeLines(int count)
+    {
+        std::string input;
+        for (int i = 0; i < count; i++) {
+            input += R"({"id": )" + std::to_string(i) + R"(, "name": "record"})" + (i % 7 ? "\n" : "\r\n\n");
+        }
+        return input;
+    }
+}
+
+TEST(JsonLines, InputOrder)
+{
+    std::string input = makeLines(20000);
+
+    for (unsigned threads : {1u, 4u, 0u}) {
+        std::vector<Json> records = JsonLines::parse(input, threads);
+        ASSERT_EQ(records.size(), 20000u);
+        for (size_t i = 0; i < records.size(); i++) {
+            ASSERT_EQ(std::any_cast<double>(records[i]["id"]), static_cast<double>(i));
+        }
+    }
+
+    std::vector<Json> records = Json::parseLines("[1]\n\n  \n[2, 3]");
+    ASSERT_EQ(records.size(), 2u);
+    EXPECT_EQ(records[1].getSize(), 2u);
+}
+
+TEST(JsonLines, Callback)
+{
+    std::string input = makeLines(20000);
+
+    std::mutex mutex;
+    std::vector<size_t> ids;
+    JsonLines::parse(input, [&](size_t offset, Json &&record) {
+        EXPECT_EQ(input[offset], '{');
+        std::lock_guard<std::mutex> lock(mutex);
+        ids.push_back(static_cast<size_t>(std::any_cast<double>(record["id"])));
+    }, 4);
+
+    std::sort(ids.begin(), ids.end());
+    ASSERT_EQ(ids.size(), 20000u);
+    EXPECT_EQ(ids.back(), 19999u);
+}
+
+TEST(JsonLines, FirstErrorIsReported)
+{
+    std::string input = makeLines(20000);
+    input.insert(input.find('\n', input.size() / 2) + 1, "[1, 2\n");
+    input += "{\"a\": 1, \"a\": 2}\n";
+
+    EXPECT_THROW(JsonLines::parse(input, 4), JsonParseUnexpectedEof);
+    EXPECT_THROW(JsonLines::parse(input, [](size_t, Json &&) {}, 4), JsonParseUnexpectedEof);
+}
\ No newline at end of file
@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+
+#include "JsonDomBuilder.hpp"
+#include "JsonNumber.hpp"
+#include "JsonParser.hpp"
+
+namespace
+{
+
+JsonNumber parseNumber(const std::string &string)
+{
+    JsonNumber number;
+    const char *end = JsonNumber::parse(string.data(), string.data() + string.size(), number);
+    EXPECT_EQ(end, string.data() + string.size()) << string;
+    return number;
+}
+
+}
+
+TEST(JsonNumber, Integers)
+{
+    auto number = parseNumber("0");
+    EXPECT_EQ(number.type, JsonNumber::Type::Integer);
+    EXPECT_EQ(number.integer, 0);
+
+    number = parseNumber("-42");
+    EXPECT_EQ(number.type, JsonNumber::Type::Integer);
+    EXPECT_EQ(number.integer, -42);
+
+    number = parseNumber("9223372036854775807");
+    EXPECT_EQ(number.type, JsonNumber::Type::Integer);
+    EXPECT_EQ(number.integer, std::numeric_limits<int64_t>::max());
+
+    number = parseNumber("-9223372036854775808");
+    EXPECT_EQ(number.type, JsonNumber::Type::Integer);
+    EXPECT_EQ(number.integer, std::numeric_limits<int64_t>::min());
+
+    number = parseNumber("18446744073709551615");
+    EXPECT_EQ(number.type, JsonNumber::Type::UnsignedInteger);
+    EXPECT_EQ(number.unsignedInteger, std::numeric_limits<uint64_t>::max());
+
+    number = parseNumber("18446744073709551616");
+    EXPECT_EQ(number.type, JsonNumber::Type::Double);
+    EXPECT_EQ(number.real, 18446744073709551616.0);
+}
+
+TEST(JsonNumber, Doubles)
+{
+    const char *inputs[] = {
+        "1.5", "-0.000123", "1e5", "1E+5", "2.5e-3", "123456789012345678901234567890",
+        "0.1", "3.141592653589793238462643383279", "1e308", "4.9e-324", "9007199254740993.0",
+        "-0", "1.7976931348623157e308", "0.30000000000000004",
+    };
+
+    for (const char *input : inputs) {
+        auto number = parseNumber(input);
+        EXPECT_EQ(number.type, JsonNumber::Type::Double) << input;
+        EXPECT_EQ(number.real, std::strtod(input, nullptr)) << input;
+    }
+
+    EXPECT_TRUE(std::signbit(parseNumber("-0").real));
+}
+
+TEST(JsonNumber, Range)
+{
+    for (const char *input : {"1e-400", "2e-324", "0.1e-999999999", "123456789012345678901234e-500"}) {
+        auto number = parseNumber(input);
+        EXPECT_EQ(number.type, JsonNumber::Type::Double) << input;
+        EXPECT_EQ(number.real, 0.0) << input;
+        EXPECT_FALSE(std::signbit(number.real)) << input;
+    }
+    EXPECT_TRUE(std::signbit(parseNumber("-1e-400").real));
+    EXPECT_EQ(std::any_cast<double>(Json{"[1e-400]"}[0]), 0.0);
+
+    for (const std::string input : {"1e400", "-1e400", "1e999999999", "1797693134862315807e291"}) {
+        JsonNumber number;
+        EXPECT_EQ(JsonNumber::parse(input.data(), input.data() + input.size(), number), nullptr) << input;
+    }
+    EXPECT_THROW(Json{"[1e400]"}, JsonParseCannotParseNumber);
+}
+
+TEST(JsonNumber, StrictGrammar)
+{
+    for (const std::string input : {"-", "+1", ".5", "1.", "1e", "1e+", "-a", "e5"}) {
+        JsonNumber number;
+        EXPECT_EQ(JsonNumber::parse(input.data(), input.data() + input.size(), number), nullptr) << input;
+    }
+
+    for (const char *input : {"[01]", "[1.2.3]", "[1e5e5]", "[-]", "[.5]", "[1.]", "[--1]"}) {
+        EXPECT_THROW(Json{input}, JsonParseCannotParseNumber) << input;
+    }
+}
+
+TEST(JsonNumber, DefaultDomStoresDouble)
+{
+    Json json{"[9007199254740993, -1]"};
+
+    EXPECT_EQ(std::any_cast<double>(json[0]), 9007199254740992.0);
+    EXPECT_EQ(std::any_cast<double>(json[1]), -1);
+}
+
+TEST(JsonNumber, PreciseIntegersThroughJson)
+{
+    const std::string input = "[9007199254740993, -9223372036854775808, 18446744073709551615, 0.5]";
+    for (const Json &json : {Json::parse(input, true), Json(input, true), Json::parseParallel(input, 4, true)}) {
+        EXPECT_EQ(std::any_cast<int64_t>(json[0]), 9007199254740993);
+        EXPECT_EQ(std::any_cast<int64_t>(json[1]), std::numeric_limits<int64_t>::min());
+        EXPECT_EQ(std::any_cast<uint64_t>(json[2]), std::numeric_limits<uint64_t>::max());
+        EXPECT_EQ(std::any_cast<double>(json[3]), 0.5);
+        EXPECT_EQ(json.dump(), "[9007199254740993,-9223372036854775808,18446744073709551615,0.5]");
+    }
+
+    Json file = Json::parseFile("../tests/TestData.json", true);
+    EXPECT_EQ(std::any_cast<int64_t>((*std::any_cast<Json *>(file["key"]))[0]), 1);
+}
+
+TEST(JsonNumber, PreciseIntegers)
+{
+    JsonDomBuilder builder{true};
+    JsonParser::parse("[9007199254740993, -1, 18446744073709551615, 0.5]", builder);
+    std::unique_ptr<Json> json{builder.release()};
+
+    EXPECT_EQ(std::any_cast<int64_t>((*json)[0]), 9007199254740993);
+    EXPECT_EQ(std::any_cast<int64_t>((*json)[1]), -1);
+    EXPECT_EQ(std::any_cast<uint64_t>((*json)[2]), std::numeric_limits<uint64_t>::max());
+    EXPECT_EQ(std::any_cast<double>((*json)[3]), 0.5);
+}
\ No newline at end of file
@@ -0,0 +1,202 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <cstdint>
+#include <fstream>
+#include <vector>
+
+#include "JsonParseCache.hpp"
+
+namespace
+{
+    const char *const DIRECTORY = "__parse_cache_test__";
+
+    void writeFile(const std::string &path, const std::string &content)
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file << content;
+    }
+
+    std::string readFile(const std::string &path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    // Каталог теста создается заново и удаляется после теста
+    struct TestDirectory
+    {
+        TestDirectory()
+        {
+            std::filesystem::remove_all(DIRECTORY);
+            std::filesystem::create_directory(DIRECTORY);
+        }
+
+        ~TestDirectory()
+        {
+            std::filesystem::remove_all(DIRECTORY);
+        }
+    };
+}
+
+TEST(JsonParseCache, NextToFile)
+{
+    TestDirectory directory;
+    std::string path = std::string(DIRECTORY) + "/data.json";
+    writeFile(path, R"({"list": [1, 2, 3], "name": "cached"})");
+
+    JsonParseCache cache;
+    EXPECT_EQ(cache.getCachePath(path), path + JsonParseCache::EXTENSION);
+
+    Json first = cache.parseFile(path);
+    EXPECT_EQ(cache.getMisses(), 1u);
+    EXPECT_TRUE(std::filesystem::exists(cache.getCachePath(path)));
+
+    Json second = cache.parseFile(path);
+    EXPECT_EQ(cache.getHits(), 1u);
+    EXPECT_EQ(std::any_cast<std::string>(second["name"]), "cached");
+    EXPECT_EQ(std::any_cast<Json *>(second["list"])->dump(), "[1,2,3]");
+}
+
+TEST(JsonParseCache, Stale)
+{
+    TestDirectory directory;
+    std::string path = std::string(DIRECTORY) + "/data.json";
+    writeFile(path, R"(["old"])");
+
+    JsonParseCache cache;
+    cache.parseFile(path);
+
+    // Тот же размер, поэтому изменение обнаруживается по содержимому
+    writeFile(path, R"(["new"])");
+    EXPECT_EQ(cache.parseFile(path).dump(), R"(["new"])");
+    EXPECT_EQ(cache.getMisses(), 2u);
+
+    EXPECT_EQ(cache.parseFile(path).dump(), R"(["new"])");
+    EXPECT_EQ(cache.getHits(), 1u);
+}
+
+TEST(JsonParseCache, Corrupt)
+{
+    TestDirectory directory;
+    std::string path = std::string(DIRECTORY) + "/data.json";
+    writeFile(path, R"(["value", 1.5, {"key": true}])");
+
+    JsonParseCache cache;
+    cache.parseFile(path);
+
+    std::string image = readFile(cache.getCachePath(path));
+    image.back() ^= 1;
+    writeFile(cache.getCachePath(path), image);
+    EXPECT_EQ(cache.parseFile(path).dump(), R"(["value",1.5,{"key":true}])");
+    EXPECT_EQ(cache.getMisses(), 2u);
+
+    writeFile(cache.getCachePath(path), image.substr(0, 10));
+    EXPECT_EQ(cache.parseFile(path).dump(), R"(["value",1.5,{"key":true}])");
+    EXPECT_EQ(cache.getMisses(), 3u);
+
+    cache.parseFile(path);
+    EXPECT_EQ(cache.getHits(), 1u);
+}
+
+TEST(JsonParseCache, Directory)
+{
+    TestDirectory directory;
+    std::string path = std::string(DIRECTORY) + "/data.json";
+    std::string cacheDirectory = std::string(DIRECTORY) + "/cache/nested";
+    writeFile(path, "[1]");
+
+    JsonParseCache cache{cacheDirectory};
+    std::string cachePath = cache.getCachePath(path);
+    EXPECT_EQ(std::filesystem::path(cachePath).parent_path(), std::filesystem::path(cacheDirectory));
+
+    cache.parseFile(path);
+    EXPECT_TRUE(std::filesystem::exists(cachePath));
+    EXPECT_EQ(cache.parseFile(path).dump(), "[1]");
+    EXPECT_EQ(cache.getHits(), 1u);
+}
+
+TEST(JsonParseCache, Document)
+{
+    TestDirectory directory;
+    std::string path = std::string(DIRECTORY) + "/data.json";
+    writeFile(path, R"({"list": [1, -2.5, true, null], "name": "cached"})");
+
+    JsonParseCache cache;
+    JsonDocument first = cache.parseDocument(path);
+    EXPECT_EQ(cache.getMisses(), 1u);
+
+    JsonDocument second = cache.parseDocument(path);
+    EXPECT_EQ(cache.getHits(), 1u);
+    EXPECT_EQ(second.root()["name"].asString(), "cached");
+    EXPECT_EQ(second.root()["list"][1].asNumber(), -2.5);
+    EXPECT_EQ(second.root()["list"].getSize(), 4u);
+
+    // Строки указывают в отображенный образ
+    std::string_view input = second.getInput();
+    const char *name = second.root()["name"].asString().data();
+    EXPECT_TRUE(name >= input.data() && name < input.data() + input.size());
+
+    // Образ общий для документа и дерева Json
+    EXPECT_EQ(cache.parseFile(path).getSize(), 2u);
+    EXPECT_EQ(cache.getHits(), 2u);
+}
+
+TEST(JsonParseCache, NumberTypes)
+{
+    TestDirectory directory;
+    std::string path = std::string(DIRECTORY) + "/data.json";
+    writeFile(path, "[3.0, 1e2, 7, 18446744073709551615]");
+
+    // Тип числа не зависит от того, был ли образ: целые дробные не становятся целыми
+    auto types = [](const JsonDocument &document) {
+        std::vector<JsonValue::Type> result;
+        for (const JsonValue &value : document.root().asArray()) {
+            result.push_back(value.getType());
+        }
+        return result;
+    };
+    JsonParseCache cache;
+    JsonDocument missed = cache.parseDocument(path);
+    JsonDocument hit = cache.parseDocument(path);
+    EXPECT_EQ(cache.getHits(), 1u);
+    EXPECT_EQ(types(hit), types(missed));
+    EXPECT_EQ(types(hit), (std::vector<JsonValue::Type>{JsonValue::Type::Double, JsonValue::Type::Double,
+                                                        JsonValue::Type::Integer, JsonValue::Type::UnsignedInteger}));
+
+    // Дерево Json из образа такое же, как у Json::parseFile с тем же preciseIntegers
+    Json precise = cache.parseFile(path, true);
+    EXPECT_EQ(cache.getHits(), 2u);
+    EXPECT_EQ(std::any_cast<double>(precise[0]), 3.0);
+    EXPECT_EQ(std::any_cast<double>(precise[1]), 100.0);
+    EXPECT_EQ(std::any_cast<int64_t>(precise[2]), 7);
+    EXPECT_EQ(std::any_cast<uint64_t>(precise[3]), UINT64_MAX);
+    EXPECT_EQ(precise.dump(), Json::parseFile(path, true).dump());
+
+    Json rounded = cache.parseFile(path);
+    EXPECT_EQ(cache.getHits(), 3u);
+    EXPECT_EQ(std::any_cast<double>(rounded[2]), 7.0);
+    EXPECT_EQ(rounded.dump(), Json::parseFile(path).dump());
+
+    // Образ из дерева без preciseIntegers не различает целые числа и перестраивается для точного чтения
+    std::filesystem::remove(cache.getCachePath(path));
+    JsonParseCache other;
+    static_cast<void>(other.parseFile(path));
+    static_cast<void>(other.parseFile(path));
+    EXPECT_EQ(other.getHits(), 1u);
+    EXPECT_EQ(types(other.parseDocument(path)), types(missed));
+    EXPECT_EQ(other.getMisses(), 2u);
+    EXPECT_EQ(std::any_cast<int64_t>(other.parseFile(path, true)[2]), 7);
+    EXPECT_EQ(other.getHits(), 2u);
+}
+
+TEST(JsonParseCache, Errors)
+{
+    TestDirectory directory;
+    std::string path = std::string(DIRECTORY) + "/broken.json";
+    writeFile(path, "[1,");
+
+    JsonParseCache cache;
+    EXPECT_THROW(cache.parseFile(path), JsonParseException);
+    EXPECT_FALSE(std::filesystem::exists(cache.getCachePath(path)));
+    EXPECT_THROW(cache.parseFile("__definitely_not_existing_file__"), JsonParseFileException);
+}
\ No newline at end of file
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+#include "JsonFixedObject.hpp"
+
+namespace
+{
+    constexpr JsonPerfectHash KEYS{"ticker", "id", "description"};
+
+    static_assert(KEYS.indexOf("ticker") == 0);
+    static_assert(KEYS.indexOf("description") == 2);
+    static_assert(KEYS.find("tickers") == KEYS.NOT_FOUND);
+    static_assert(KEYS.getKey(1) == "id");
+
+    // Наибольший набор ключей: "k000" ... "k253"
+    constexpr size_t MAX_KEYS = 254;
+
+    struct KeyStorage
+    {
+        char data[MAX_KEYS][4];
+    };
+
+    constexpr KeyStorage makeKeyStorage()
+    {
+        KeyStorage storage{};
+        for (size_t i = 0; i < MAX_KEYS; i++) {
+            storage.data[i][0] = 'k';
+            storage.data[i][1] = static_cast<char>('0' + i / 100);
+            storage.data[i][2] = static_cast<char>('0' + i / 10 % 10);
+            storage.data[i][3] = static_cast<char>('0' + i % 10);
+        }
+        return storage;
+    }
+
+    constexpr KeyStorage KEY_STORAGE = makeKeyStorage();
+
+    constexpr std::array<std::string_view, MAX_KEYS> makeKeyList()
+    {
+        std::array<std::string_view, MAX_KEYS> keyList{};
+        for (size_t i = 0; i < MAX_KEYS; i++) {
+            keyList[i] = std::string_view(KEY_STORAGE.data[i], 4);
+        }
+        return keyList;
+    }
+
+    constexpr JsonPerfectHash MAX_KEY_SET{makeKeyList()};
+
+    static_assert(MAX_KEY_SET.getSize() == MAX_KEYS);
+    static_assert(MAX_KEY_SET.indexOf("k253") == 253);
+}
+
+TEST(JsonPerfectHash, Find)
+{
+    EXPECT_EQ(KEYS.find("id"), 1u);
+    EXPECT_EQ(KEYS.find(""), KEYS.NOT_FOUND);
+    EXPECT_EQ(KEYS.find("i"), KEYS.NOT_FOUND);
+    EXPECT_EQ(KEYS.find("ID"), KEYS.NOT_FOUND);
+    EXPECT_THROW(static_cast<void>(KEYS.indexOf("unknown")), JsonUnexpectedKey);
+
+    constexpr JsonPerfectHash<0> empty{};
+    EXPECT_EQ(empty.find("id"), empty.NOT_FOUND);
+
+    static constexpr JsonPerfectHash many{
+        "k0", "k1", "k2", "k3", "k4", "k5", "k6", "k7", "k8", "k9",
+        "k10", "k11", "k12", "k13", "k14", "k15", "k16", "k17", "k18", "k19",
+        "k20", "k21", "k22", "k23", "k24", "k25", "k26", "k27", "k28", "k29",
+        "k30", "k31", "k32", "k33", "k34", "k35", "k36", "k37", "k38", "k39"
+    };
+    for (size_t i = 0; i < many.getSize(); i++) {
+        EXPECT_EQ(many.find("k" + std::to_string(i)), i);
+    }
+    EXPECT_EQ(many.find("k40"), many.NOT_FOUND);
+
+    for (size_t i = 0; i < MAX_KEY_SET.getSize(); i++) {
+        EXPECT_EQ(MAX_KEY_SET.find(MAX_KEY_SET.getKey(i)), i);
+    }
+    EXPECT_EQ(MAX_KEY_SET.find("k254"), MAX_KEY_SET.NOT_FOUND);
+
+    EXPECT_THROW(JsonPerfectHash("a", "b", "a"), JsonException);
+}
+
+TEST(JsonFixedObject, Parse)
+{
+    using Record = JsonFixedObject<KEYS>;
+
+    auto record = Record::parse(R"({"id": 7, "extra": {"a": [1, "}"]}, "ticker": "ABC",
+                                    "description": {"text": "d", "tags": ["x"]}})");
+    EXPECT_EQ(record.get<KEYS.indexOf("ticker")>().asString(), "ABC");
+    EXPECT_EQ(record.get<KEYS.indexOf("id")>().asInteger(), 7);
+    EXPECT_EQ(record.get<KEYS.indexOf("description")>()["tags"][0].asString(), "x");
+    EXPECT_TRUE(record.contains<KEYS.indexOf("id")>());
+    ASSERT_NE(record.find("ticker"), nullptr);
+    EXPECT_EQ(record.find("extra"), nullptr);
+
+    auto partial = Record::parse(R"({"id": null})");
+    EXPECT_TRUE(partial.contains<KEYS.indexOf("id")>());
+    EXPECT_FALSE(partial.contains<KEYS.indexOf("ticker")>());
+    EXPECT_TRUE(partial.get<KEYS.indexOf("ticker")>().is_null());
+    EXPECT_EQ(partial.find("ticker"), nullptr);
+
+    Record fromValue{JsonValue::parse(R"({"ticker": "T", "other": 1})")};
+    EXPECT_EQ(fromValue.get<KEYS.indexOf("ticker")>().asString(), "T");
+    EXPECT_FALSE(fromValue.contains<KEYS.indexOf("id")>());
+
+    EXPECT_THROW(Record::parse(R"({"id": 1, "id": 2})"), JsonParseDuplicatedKeyError);
+    EXPECT_THROW(Record::parse("[1]"), JsonParseUnexpectedChar);
+    EXPECT_THROW(Record::parse(R"({"id": [1)"), JsonParseException);
+    EXPECT_THROW(Record::parse(R"({"id": 1, "extra": [1}})"), JsonParseUnexpectedChar);
+    EXPECT_THROW(Record::parse(R"({"id": 1, "extra": tru})"), JsonParseUnexpectedChar);
+}
\ No newline at end of file
@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#include "JsonDocument.hpp"
+#include "JsonPointer.hpp"
+
+namespace
+{
+    // Пример из RFC 6901
+    const std::string EXAMPLE = R"({
+        "foo": ["bar", "baz"],
+        "": 0,
+        "a/b": 1,
+        "c%d": 2,
+        "e^f": 3,
+        "g|h": 4,
+        "i\\j": 5,
+        "k\"l": 6,
+        " ": 7,
+        "m~n": 8,
+        "deep": {"list": [{"id": 10}, {"id": 11}]}
+    })";
+}
+
+TEST(JsonPointer, Rfc6901)
+{
+    auto document = JsonDocument::parse(EXAMPLE);
+    const JsonValue &root = document.root();
+
+    EXPECT_EQ(JsonPointer("").find(root), &root);
+    EXPECT_EQ(JsonPointer("/foo").get(root).getSize(), 2u);
+    EXPECT_EQ(JsonPointer("/foo/0").get(root).asString(), "bar");
+    EXPECT_EQ(JsonPointer("/").get(root).asInteger(), 0);
+    EXPECT_EQ(JsonPointer("/a~1b").get(root).asInteger(), 1);
+    EXPECT_EQ(JsonPointer("/c%d").get(root).asInteger(), 2);
+    EXPECT_EQ(JsonPointer("/i\\j").get(root).asInteger(), 5);
+    EXPECT_EQ(JsonPointer("/k\"l").get(root).asInteger(), 6);
+    EXPECT_EQ(JsonPointer("/ ").get(root).asInteger(), 7);
+    EXPECT_EQ(JsonPointer("/m~0n").get(root).asInteger(), 8);
+    EXPECT_EQ(JsonPointer("/deep/list/1/id").get(root).asInteger(), 11);
+
+    EXPECT_EQ(JsonPointer("/foo/2").find(root), nullptr);
+    EXPECT_EQ(JsonPointer("/foo/01").find(root), nullptr);
+    EXPECT_EQ(JsonPointer("/foo/-").find(root), nullptr);
+    EXPECT_EQ(JsonPointer("/missing/0").find(root), nullptr);
+    EXPECT_THROW(static_cast<void>(JsonPointer("/missing").get(root)), JsonUnexpectedKey);
+
+    EXPECT_EQ(JsonPointer("/a~1b/m~0n").toString(), "/a~1b/m~0n");
+    EXPECT_THROW(JsonPointer("foo"), JsonPointerException);
+    EXPECT_THROW(JsonPointer("/a~2"), JsonPointerException);
+}
+
+TEST(JsonPointer, Json)
+{
+    Json json{EXAMPLE};
+
+    EXPECT_EQ(JsonPointer("").find(json), nullptr);
+    EXPECT_EQ(std::any_cast<std::string>(*JsonPointer("/foo/1").find(json)), "baz");
+    EXPECT_EQ(std::any_cast<double>(*JsonPointer("/deep/list/0/id").find(json)), 10);
+    EXPECT_EQ(JsonPointer("/foo/1/x").find(json), nullptr);
+    EXPECT_EQ(JsonPointer("/deep/none").find(json), nullptr);
+}
+
+TEST(JsonPointer, Batch)
+{
+    std::vector<JsonPointer> pointers{
+        JsonPointer("/deep/list/0/id"),
+        JsonPointer("/deep/list/1/id"),
+        JsonPointer("/deep/missing"),
+        JsonPointer("/foo/0"),
+        JsonPointer("/deep/list/0/id"),
+        JsonPointer(""),
+    };
+    JsonPointerBatch batch{pointers};
+
+    auto document = JsonDocument::parse(EXAMPLE);
+    std::vector<const JsonValue *> values = batch.find(document.root());
+    ASSERT_EQ(values.size(), pointers.size());
+    EXPECT_EQ(values[0]->asInteger(), 10);
+    EXPECT_EQ(values[1]->asInteger(), 11);
+    EXPECT_EQ(values[2], nullptr);
+    EXPECT_EQ(values[3]->asString(), "bar");
+    EXPECT_EQ(values[4], values[0]);
+    EXPECT_EQ(values[5], &document.root());
+
+    Json json{EXAMPLE};
+    std::vector<const std::any *> anys = batch.find(json);
+    EXPECT_EQ(std::any_cast<double>(*anys[1]), 11);
+    EXPECT_EQ(anys[2], nullptr);
+    EXPECT_EQ(std::any_cast<std::string>(*anys[3]), "bar");
+    EXPECT_EQ(anys[5], nullptr);
+}
\ No newline at end of file
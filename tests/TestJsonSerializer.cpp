@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+#include <sstream>
+
+#include "Json.hpp"
+#include "JsonDomBuilder.hpp"
+#include "JsonParser.hpp"
+#include "JsonSerializer.hpp"
+
+TEST(JsonSerializer, Compact)
+{
+    Json json{R"([1, 2.5, -0.1, 1e300, "text", true, false, null, [], {}, [[1], {"a": "b"}]])"};
+    EXPECT_EQ(json.dump(), R"([1,2.5,-0.1,1e+300,"text",true,false,null,[],{},[[1],{"a":"b"}]])");
+
+    EXPECT_EQ(Json{}.dump(), "null");
+}
+
+TEST(JsonSerializer, Pretty)
+{
+    Json json{R"([1, {"key": [true]}, []])"};
+    EXPECT_EQ(json.dump(2), "[\n  1,\n  {\n    \"key\": [\n      true\n    ]\n  },\n  []\n]");
+}
+
+TEST(JsonSerializer, Escapes)
+{
+    Json json{R"(["quote \" backslash \\ slash \/ \b\f\n\r\t \u0001 é"])"};
+    EXPECT_EQ(json.dump(), "[\"quote \\\" backslash \\\\ slash / \\b\\f\\n\\r\\t \\u0001 \xC3\xA9\"]");
+}
+
+TEST(JsonSerializer, RoundTrip)
+{
+    std::string text = R"({"name": "Ivanov", "marks": [4, 5.5, 0.30000000000000004, -1.7976931348623157e308],
+        "address": {"city": "Moscow"}, "empty": null})";
+    Json json{text};
+
+    Json back{json.dump()};
+    EXPECT_EQ(back.dump().size(), json.dump().size());
+    EXPECT_EQ(std::any_cast<std::string>(back["name"]), "Ivanov");
+
+    Json &marks = *std::any_cast<Json *>(back["marks"]);
+    EXPECT_EQ(std::any_cast<double>(marks[2]), 0.30000000000000004);
+    EXPECT_EQ(std::any_cast<double>(marks[3]), -1.7976931348623157e308);
+}
+
+TEST(JsonSerializer, PreciseIntegers)
+{
+    JsonDomBuilder builder{true};
+    JsonParser::parse(R"([9007199254740993, -9223372036854775808, 18446744073709551615])", builder);
+    std::unique_ptr<Json> json{builder.release()};
+
+    EXPECT_EQ(json->dump(), "[9007199254740993,-9223372036854775808,18446744073709551615]");
+}
+
+TEST(JsonSerializer, SizeAndStream)
+{
+    std::string input = "[";
+    for (int i = 0; i < 10000; i++) {
+        input += R"({"id": )" + std::to_string(i) + R"(, "text": "line\nbreak"},)";
+    }
+    input += '"' + std::string(100000, 'x') + "\"]";
+    Json json{input};
+
+    for (int indent : {-1, 0, 4}) {
+        JsonSerializer serializer{indent};
+        std::string text = serializer.dump(json);
+        EXPECT_EQ(serializer.getSize(json), text.size());
+
+        std::ostringstream stream;
+        json.write(stream, indent);
+        EXPECT_EQ(stream.str(), text);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+#include <random>
+
+#include "Json.hpp"
+#include "JsonSimd.hpp"
+#include "JsonStructuralIndex.hpp"
+
+TEST(JsonSimd, ImplementationsAgree)
+{
+    const std::string alphabet = " \t\r\n,:[]{}\"'\\a1\0";
+    std::mt19937 random{42};
+    std::uniform_int_distribution<size_t> pick{0, alphabet.size() - 1};
+
+    char block[JsonSimd::BLOCK_SIZE];
+    for (int round = 0; round < 1000; round++) {
+        for (char &c : block) {
+            c = alphabet[pick(random)];
+        }
+
+        auto expected = JsonSimd::classify(block, JsonSimd::Implementation::Scalar);
+        for (auto implementation : {JsonSimd::Implementation::Sse42, JsonSimd::Implementation::Avx2}) {
+            if (!JsonSimd::isSupported(implementation)) {
+                continue;
+            }
+
+            auto masks = JsonSimd::classify(block, implementation);
+            EXPECT_EQ(masks.space, expected.space);
+            EXPECT_EQ(masks.structural, expected.structural);
+            EXPECT_EQ(masks.quote, expected.quote);
+            EXPECT_EQ(masks.singleQuote, expected.singleQuote);
+            EXPECT_EQ(masks.backslash, expected.backslash);
+        }
+    }
+}
+
+TEST(JsonSimd, StructuralIndex)
+{
+    const std::string input = R"({ "a,\"b": [12, 'x"]', true] })";
+    JsonStructuralIndex index{input.data(), input.data() + input.size()};
+
+    std::vector<size_t> offsets;
+    for (const char *position = index.next(input.data());
+         position != input.data() + input.size();
+         position = index.next(position + 1)) {
+        offsets.push_back(position - input.data());
+    }
+
+    // { " " : [ 1 , ' ' , t ] }
+    std::vector<size_t> expected = {0, 2, 8, 9, 11, 12, 14, 16, 20, 21, 23, 27, 29};
+    EXPECT_EQ(offsets, expected);
+}
+
+TEST(JsonSimd, LongStringAcrossWindows)
+{
+    std::string text;
+    for (int i = 0; i < 20000; i++) {
+        text += "[{'\\\",:";
+    }
+
+    Json json{"[\"" + text + "\", 1]"};
+    EXPECT_EQ(json.getSize(), 2u);
+
+    std::string expected;
+    for (int i = 0; i < 20000; i++) {
+        expected += "[{'\",:";
+    }
+    EXPECT_EQ(std::any_cast<std::string>(json[0]), expected);
+    EXPECT_EQ(std::any_cast<double>(json[1]), 1);
+}
+
+TEST(JsonSimd, EscapeOnBlockBoundary)
+{
+    for (size_t padding = 0; padding < 2 * JsonSimd::BLOCK_SIZE; padding++) {
+        std::string input = "[" + std::string(padding, ' ') + R"("a\\", "b\"c"])";
+
+        Json json{input};
+        ASSERT_EQ(json.getSize(), 2u);
+        EXPECT_EQ(std::any_cast<std::string>(json[0]), "a\\");
+        EXPECT_EQ(std::any_cast<std::string>(json[1]), "b\"c");
+    }
+}
+
+TEST(JsonSimd, GarbageAfterToken)
+{
+    EXPECT_THROW(
+        Json{"[1x, 2]"},
+        JsonParseException
+    );
+    EXPECT_THROW(
+        Json{R"(["a"b])"},
+        JsonParseException
+    );
+    EXPECT_THROW(
+        Json{"[true false]"},
+        JsonParseException
+    );
+}
\ No newline at end of file
@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+
+#include "Json.hpp"
+#include "JsonString.hpp"
+
+namespace
+{
+
+std::string decode(const std::string &input)
+{
+    std::string output;
+    JsonString::decode(input.data(), input.data() + input.size(), output);
+    return output;
+}
+
+}
+
+TEST(JsonString, NoEscapes)
+{
+    EXPECT_EQ(decode(""), "");
+    EXPECT_EQ(decode("plain text"), "plain text");
+}
+
+TEST(JsonString, SimpleEscapes)
+{
+    EXPECT_EQ(decode(R"(\"\\\/\b\f\n\r\t\')"), "\"\\/\b\f\n\r\t'");
+    EXPECT_EQ(decode(R"(a\\"b)"), "a\\\"b");
+}
+
+TEST(JsonString, UnicodeEscapes)
+{
+    EXPECT_EQ(decode(R"(\u0041)"), "A");
+    EXPECT_EQ(decode(R"(\u00e9)"), "\xC3\xA9");
+    EXPECT_EQ(decode(R"(\u20AC)"), "\xE2\x82\xAC");
+    EXPECT_EQ(decode(R"(\ud83d\ude00!)"), "\xF0\x9F\x98\x80!");
+    EXPECT_EQ(decode(R"(\u0000)"), std::string(1, '\0'));
+}
+
+TEST(JsonString, InvalidEscapes)
+{
+    for (const std::string input : {R"(\x)", R"(\)", R"(\u12)", R"(\u12g4)", R"(\ud83d)", R"(\ud83dx)",
+                                    R"(\ud83d\u0041)", R"(\ude00)"}) {
+        EXPECT_THROW(decode(input), JsonParseInvalidEscape) << input;
+    }
+}
+
+TEST(JsonString, EscapesInDocument)
+{
+    Json json{R"({"caf\u00e9": "line\r\nnext", "path": "a\/b"})"};
+
+    EXPECT_EQ(std::any_cast<std::string>(json["caf\xC3\xA9"]), "line\r\nnext");
+    EXPECT_EQ(std::any_cast<std::string>(json["path"]), "a/b");
+
+    EXPECT_THROW(
+        Json{R"(["bad \q escape"])"},
+        JsonParseInvalidEscape
+    );
+}
\ No newline at end of file
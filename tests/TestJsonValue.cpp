@@ -0,0 +1,165 @@
+#include <gtest/gtest.h>
+#include <utility>
+
+#include "Json.hpp"
+#include "JsonDocument.hpp"
+#include "JsonObject.hpp"
+#include "JsonValue.hpp"
+
+TEST(JsonValue, Scalars)
+{
+    EXPECT_EQ(JsonValue{}.is_null(), true);
+    EXPECT_EQ(JsonValue{true}.asBool(), true);
+    EXPECT_EQ(JsonValue{42}.asInteger(), 42);
+    EXPECT_EQ(JsonValue{42}.asNumber(), 42.);
+    EXPECT_EQ(JsonValue{1.5}.asNumber(), 1.5);
+    EXPECT_EQ(JsonValue{"text"}.asString(), "text");
+    EXPECT_EQ(JsonValue{uint64_t{18446744073709551615u}}.getType(), JsonValue::Type::UnsignedInteger);
+
+    EXPECT_THROW(static_cast<void>(JsonValue{"text"}.asNumber()), JsonUnexpectedType);
+    EXPECT_THROW(static_cast<void>(JsonValue{1.5}.asInteger()), JsonUnexpectedType);
+}
+
+TEST(JsonValue, Parse)
+{
+    JsonValue value = JsonValue::parse(R"({"a": [1, 2.5, "x", null, true], "b": {"c": -7}})");
+
+    EXPECT_EQ(value.is_object(), true);
+    EXPECT_EQ(value.getSize(), 2u);
+    EXPECT_EQ(value["a"].getSize(), 5u);
+    EXPECT_EQ(value["a"][0].asInteger(), 1);
+    EXPECT_EQ(value["a"][1].asNumber(), 2.5);
+    EXPECT_EQ(value["a"][2].asString(), "x");
+    EXPECT_EQ(value["a"][3].is_null(), true);
+    EXPECT_EQ(value["a"][4].asBool(), true);
+    EXPECT_EQ(value["b"]["c"].asInteger(), -7);
+
+    EXPECT_THROW(value["missing"], JsonUnexpectedKey);
+    EXPECT_THROW(value[0], JsonUnexpectedType);
+    EXPECT_THROW(value["a"][5], JsonUnexpectedKey);
+    EXPECT_THROW(JsonValue::parse(R"({"a": 1, "a": 2})"), JsonParseDuplicatedKeyError);
+}
+
+TEST(JsonValue, CopyIsDeep)
+{
+    JsonValue value = JsonValue::parse(R"({"list": [1, 2], "name": "first"})");
+    JsonValue copy = value;
+
+    copy["list"].addToArray(3);
+    copy.addToObjectKey("name", "second");
+
+    EXPECT_EQ(value["list"].getSize(), 2u);
+    EXPECT_EQ(value["name"].asString(), "first");
+    EXPECT_EQ(copy["list"].getSize(), 3u);
+    EXPECT_EQ(copy["name"].asString(), "second");
+
+    JsonValue moved = std::move(copy);
+    EXPECT_EQ(copy.is_null(), true);
+    EXPECT_EQ(moved["list"][2].asInteger(), 3);
+}
+
+TEST(JsonValue, AssignFromChild)
+{
+    // Присваиваемое значение принадлежит тому, кому присваивают
+    JsonValue moved = JsonValue::parse(R"({"k": [1, 2, 3]})");
+    moved = std::move(moved["k"]);
+    EXPECT_EQ(moved.is_array(), true);
+    EXPECT_EQ(moved.getSize(), 3u);
+    moved = std::move(moved[1]);
+    EXPECT_EQ(moved.asInteger(), 2);
+
+    JsonValue copied = JsonValue::parse(R"([{"name": "value"}, 1])");
+    copied = copied[0];
+    EXPECT_EQ(copied["name"].asString(), "value");
+    copied = copied["name"];
+    EXPECT_EQ(copied.asString(), "value");
+}
+
+TEST(JsonValue, Build)
+{
+    JsonValue value = JsonValue::object();
+    value.addToObjectKey("key", "value");
+    value.addToObjectKey("list", JsonValue::array());
+    value["list"].addToArray(false);
+    value["list"].addToArray(nullptr);
+
+    EXPECT_EQ(value.getKeys(), (std::vector<std::string_view>{"key", "list"}));
+    EXPECT_EQ(value["list"][0].asBool(), false);
+    EXPECT_EQ(value["list"][1].is_null(), true);
+
+    EXPECT_THROW(value.addToArray(1), JsonUnexpectedType);
+    EXPECT_THROW(value["key"].addToObjectKey("k", 1), JsonUnexpectedType);
+}
+
+TEST(JsonValue, CompatibilityWithJson)
+{
+    Json json{R"({"age": 25, "name": "Ivan", "marks": [4, 5], "legal": false, "none": null})"};
+
+    JsonValue value{json};
+    EXPECT_EQ(value["age"].get<double>(), 25);
+    EXPECT_EQ(value["age"].get<int>(), 25);
+    EXPECT_EQ(value["name"].get<std::string>(), "Ivan");
+    EXPECT_EQ(value["marks"][1].get<double>(), 5);
+    EXPECT_EQ(value["legal"].get<bool>(), false);
+    EXPECT_EQ(value["none"].is_null(), true);
+    EXPECT_THROW(static_cast<void>(value["name"].get<bool>()), JsonUnexpectedType);
+
+    Json back = value.toJson();
+    EXPECT_EQ(std::any_cast<double>(back["age"]), 25);
+    EXPECT_EQ(std::any_cast<std::string>(back["name"]), "Ivan");
+    EXPECT_EQ(std::any_cast<double>((*std::any_cast<Json *>(back["marks"]))[0]), 4);
+    EXPECT_EQ(back["none"].has_value(), false);
+}
+
+TEST(JsonValue, LargeObject)
+{
+    // Больше INDEX_THRESHOLD ключей: поиск идет через индекс
+    std::string text = "{";
+    for (int i = 0; i < 1000; i++) {
+        text += (i ? ",\"key" : "\"key") + std::to_string(i) + "\": " + std::to_string(i);
+    }
+    text += "}";
+
+    JsonValue value = JsonValue::parse(text);
+    JsonDocument document = JsonDocument::parse(text);
+    for (const JsonValue *object : {&std::as_const(value), &document.root()}) {
+        EXPECT_EQ(object->getSize(), 1000);
+        EXPECT_EQ(object->getKeys()[999], "key999");
+        EXPECT_EQ((*object)["key0"].asInteger(), 0);
+        EXPECT_EQ((*object)["key777"].asInteger(), 777);
+        EXPECT_EQ(object->asObject().find("key1000"), nullptr);
+    }
+
+    JsonValue copy = value;
+    copy.addToObjectKey("key5", "five");
+    copy.addToObjectKey("extra", true);
+    EXPECT_EQ(copy["key5"].asString(), "five");
+    EXPECT_EQ(copy["extra"].asBool(), true);
+    EXPECT_EQ(value["key5"].asInteger(), 5);
+    EXPECT_EQ(copy.getSize(), 1001);
+}
+
+TEST(JsonValue, ReservedObject)
+{
+    // reserve строит индекс заранее, пока пар еще меньше INDEX_THRESHOLD
+    JsonValue value = JsonValue::object();
+    value.reserve(20);
+    value.addToObjectKey("a", JsonValue(1.0));
+    ASSERT_NE(value.asObject().find("a"), nullptr);
+    EXPECT_EQ(value["a"].asNumber(), 1.0);
+    EXPECT_EQ(std::as_const(value)["a"].asNumber(), 1.0);
+    EXPECT_EQ(value.asObject().find("b"), nullptr);
+}
+
+TEST(JsonValue, DuplicatedKeys)
+{
+    EXPECT_THROW(JsonValue::parse(R"({"a": 1, "b": 2, "a": 3})"), JsonParseDuplicatedKeyError);
+    EXPECT_THROW(JsonDocument::parse(R"([{"a": {"b": 1, "b": 2}}])"), JsonParseDuplicatedKeyError);
+
+    std::string text = "{";
+    for (int i = 0; i < 100; i++) {
+        text += "\"key" + std::to_string(i) + "\": 0,";
+    }
+    text += "\"key42\": 1}";
+    EXPECT_THROW(JsonValue::parse(text), JsonParseDuplicatedKeyError);
+}
\ No newline at end of file
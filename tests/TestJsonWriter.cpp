@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <sstream>
+
+#include "Json.hpp"
+#include "JsonWriter.hpp"
+
+TEST(JsonWriter, SameAsDump)
+{
+    Json json{R"([1, 2.5, "line\nbreak", true, null, [], {}, {"key": [false]}])"};
+
+    for (int indent : {-1, 4}) {
+        std::ostringstream stream;
+        {
+            JsonWriter writer{stream, indent};
+            writer.beginArray()
+                .value(1).value(2.5).value("line\nbreak").value(true).value(nullptr)
+                .beginArray().endArray()
+                .beginObject().endObject()
+                .beginObject().key("key").beginArray().value(false).endArray().endObject()
+                .endArray();
+        }
+        EXPECT_EQ(stream.str(), json.dump(indent));
+    }
+}
+
+TEST(JsonWriter, LargeDocument)
+{
+    // Документ много больше буфера пишется в файл по частям
+    FILE *file = std::tmpfile();
+    ASSERT_NE(file, nullptr);
+
+    std::string longString(JsonWriter::BUFFER_SIZE * 2, 'x');
+    {
+        JsonWriter writer{fileno(file)};
+        writer.beginArray();
+        for (int64_t i = 0; i < 100000; i++) {
+            writer.beginObject().key("id").value(i).key("name").value("item").endObject();
+        }
+        writer.value(longString);
+        writer.endArray();
+        writer.flush();
+    }
+
+    std::string text(static_cast<size_t>(std::ftell(file)), '\0');
+    std::rewind(file);
+    ASSERT_EQ(std::fread(text.data(), 1, text.size(), file), text.size());
+    std::fclose(file);
+
+    Json json{text};
+    EXPECT_EQ(json.getSize(), 100001u);
+    EXPECT_EQ(std::any_cast<double>((*std::any_cast<Json *>(json[99999]))["id"]), 99999);
+    EXPECT_EQ(std::any_cast<std::string>(json[100000]), longString);
+}
+
+#ifndef NDEBUG
+TEST(JsonWriter, NestingIsChecked)
+{
+    std::ostringstream stream;
+
+    EXPECT_THROW(JsonWriter(stream).beginObject().value(1), JsonWriteException);
+    EXPECT_THROW(JsonWriter(stream).beginArray().key("key"), JsonWriteException);
+    EXPECT_THROW(JsonWriter(stream).beginArray().endObject(), JsonWriteException);
+    EXPECT_THROW(JsonWriter(stream).beginObject().key("key").endObject(), JsonWriteException);
+    EXPECT_THROW(JsonWriter(stream).endArray(), JsonWriteException);
+    EXPECT_THROW(JsonWriter(stream).value(1).value(2), JsonWriteException);
+}
+#endif
\ No newline at end of file